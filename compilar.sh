@@ -1,11 +1,21 @@
 #!/bin/bash
 
-src=("burbuja" "heapsort" "insercion" "mergesort" "quicksort" "seleccion")
+src=("medicion" "contadores" "perfil_memoria" "arena" "planificador" "procesador" "generador" "particion_vectorial" "umbrales" "externo" "datos" "benchmark")
 
+mkdir -p ejecutables
+
+fuentes=()
 for e in "${src[@]}"
 do
-	echo "Compilando src/${e}.cpp"
-	gcc -O2 "src/${e}.cpp" -o "ejecutables/${e}" -lstdc++
-	echo "src/${e}.cpp compilado en ejecutables/${e}"
-	echo "" 
+	fuentes+=("src/${e}.cpp")
 done
+
+echo "Compilando ${fuentes[*]}"
+gcc -O2 "${fuentes[@]}" -o "ejecutables/benchmark" -lstdc++ -lm -pthread || exit 1
+echo "Banco de pruebas compilado en ejecutables/benchmark"
+echo ""
+
+echo "Compilando src/regresion.cpp"
+gcc -O2 src/regresion.cpp -o "ejecutables/regresion" -lstdc++ -lm || exit 1
+echo "Comparador de regresiones compilado en ejecutables/regresion"
+echo ""
@@ -0,0 +1,42 @@
+/**
+   @file algoritmos.h
+   @brief Biblioteca de algoritmos de ordenación, sólo de cabeceras.
+   @date 2026-10-17
+
+   Todos los algoritmos son plantillas sobre el tipo de elemento y el
+   criterio de orden (por defecto operator<), por lo que se instancian
+   en tiempo de compilación para cada tipo sin llamadas indirectas en
+   las comparaciones. radix no compara: ordena por la clave de
+   ClaveRadix, definida para cada tipo de tipos.h. quicksort_vectorial
+   divide los float con los núcleos SIMD de particion_vectorial.cpp,
+   elegidos en tiempo de ejecución. indices.h ordena registros a través
+   de pares (clave, índice) de 64 bits en lugar de moverlos enteros.
+   parcial.h no ordena todo el vector: selecciona el k-ésimo menor u
+   ordena sólo los k menores. incremental.h mantiene vectores ordenados
+   a los que se añaden lotes mezclándolos con fusion_galope.
+*/
+
+#ifndef ALGORITMOS_H
+#define ALGORITMOS_H
+
+#include "tipos.h"
+
+#include "burbuja.h"
+#include "insercion.h"
+#include "seleccion.h"
+#include "heapsort.h"
+#include "mergesort.h"
+#include "mergesort_kvias.h"
+#include "mergesort_natural.h"
+#include "quicksort.h"
+#include "radix.h"
+#include "quicksort_vectorial.h"
+#include "indices.h"
+#include "parcial.h"
+#include "incremental.h"
+
+#include "mergesort_paralelo.h"
+#include "quicksort_paralelo.h"
+
+
+#endif
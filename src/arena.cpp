@@ -0,0 +1,218 @@
+/**
+   @file arena.cpp
+   @brief Arena de memoria alineada y con páginas grandes para vectores y auxiliares.
+   @date 2026-10-17
+*/
+
+
+#include "arena.h"
+#include "perfil_memoria.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+using std::string;
+
+
+/**
+   Tamaño de una página grande, al que se alinean y redondean las regiones.
+**/
+static const size_t PAGINA_GRANDE = (size_t) 2 << 20;
+
+/**
+   Bloques vivos a la vez para los que se reserva sitio al abrir: la
+   recursión de mergesort sobre 2^31 elementos tiene 2 * 31.
+**/
+static const size_t BLOQUES_PREVISTOS = 128;
+
+
+static thread_local Arena * actual = NULL;
+
+
+Arena * arena_hilo()
+{
+  return actual;
+}
+
+
+void fijar_arena_hilo(Arena * arena)
+{
+  actual = arena;
+}
+
+
+Arena::Arena()
+  : base(NULL), bytes(0), tipo(PAGINAS_4K), ocupado(0)
+{
+}
+
+
+Arena::~Arena()
+{
+  cerrar();
+}
+
+
+/**
+   @brief Proyecta bytes bytes anónimos alineados a PAGINA_GRANDE.
+
+   Proyecta PAGINA_GRANDE bytes de más y devuelve lo que sobra por
+   delante y por detrás, para que las páginas grandes transparentes
+   puedan cubrir la región entera.
+*/
+static char * proyectar_alineado(size_t bytes)
+{
+  size_t total = bytes + PAGINA_GRANDE;
+  void * p = mmap(NULL, total, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (p == MAP_FAILED)
+    return NULL;
+  char * inicio = static_cast<char *>(p);
+  char * alineado = reinterpret_cast<char *>(
+    ((uintptr_t) inicio + PAGINA_GRANDE - 1) & ~(uintptr_t) (PAGINA_GRANDE - 1));
+  if (alineado > inicio)
+    munmap(inicio, alineado - inicio);
+  size_t detras = (inicio + total) - (alineado + bytes);
+  if (detras > 0)
+    munmap(alineado + bytes, detras);
+  return alineado;
+}
+
+
+bool Arena::abrir(size_t bytes, TipoPaginas paginas, string & error)
+{
+  cerrar();
+  bytes = (bytes + PAGINA_GRANDE - 1) / PAGINA_GRANDE * PAGINA_GRANDE;
+  if (bytes == 0)
+    bytes = PAGINA_GRANDE;
+
+  char * p = NULL;
+#ifdef MAP_HUGETLB
+  if (paginas == PAGINAS_HUGETLB) {
+    void * q = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (q != MAP_FAILED)
+      p = static_cast<char *>(q);
+    else
+      paginas = PAGINAS_2M;
+  }
+#else
+  if (paginas == PAGINAS_HUGETLB)
+    paginas = PAGINAS_2M;
+#endif
+
+  if (p == NULL) {
+    p = proyectar_alineado(bytes);
+    if (p == NULL) {
+      std::ostringstream ss;
+      ss << "no se pueden proyectar " << (bytes >> 20) << " MiB: "
+         << strerror(errno);
+      error = ss.str();
+      return false;
+    }
+#if defined(MADV_HUGEPAGE) && defined(MADV_NOHUGEPAGE)
+    madvise(p, bytes, paginas == PAGINAS_2M ? MADV_HUGEPAGE : MADV_NOHUGEPAGE);
+#endif
+  }
+
+  base = p;
+  this->bytes = bytes;
+  tipo = paginas;
+  ocupado = 0;
+  bloques.clear();
+  bloques.reserve(BLOQUES_PREVISTOS);
+  return true;
+}
+
+
+void Arena::cerrar()
+{
+  if (base != NULL)
+    munmap(base, bytes);
+  base = NULL;
+  bytes = 0;
+  ocupado = 0;
+  bloques.clear();
+}
+
+
+void Arena::prefallar()
+{
+  long pagina = tipo == PAGINAS_4K ? sysconf(_SC_PAGESIZE) : PAGINA_GRANDE;
+  volatile char * p = base;
+  for (size_t i = 0; i < bytes; i += pagina)
+    p[i] = 0;
+}
+
+
+void * Arena::reservar(size_t n)
+{
+  size_t inicio = (ocupado + ALINEACION_ARENA - 1) & ~(ALINEACION_ARENA - 1);
+  if (base == NULL || n > bytes - std::min(inicio, bytes))
+    return NULL;
+  Bloque bloque = { inicio, n, false };
+  bloques.push_back(bloque);
+  ocupado = inicio + n;
+  anotar_reserva(n);
+  return base + inicio;
+}
+
+
+void Arena::liberar(void * p)
+{
+  size_t inicio = static_cast<char *>(p) - base;
+  size_t b = bloques.size();
+  while (b > 0 && bloques[b - 1].inicio != inicio)
+    b--;
+  if (b == 0)
+    return;
+  bloques[b - 1].libre = true;
+  anotar_liberacion(bloques[b - 1].bytes);
+
+  // Se recupera el espacio de los últimos bloques ya liberados
+  while (!bloques.empty() && bloques.back().libre) {
+    ocupado = bloques.back().inicio;
+    bloques.pop_back();
+  }
+}
+
+
+size_t Arena::paginas_grandes() const
+{
+  if (base == NULL)
+    return 0;
+  if (tipo == PAGINAS_HUGETLB)
+    return bytes;
+
+  // AnonHugePages de las proyecciones de la región (madvise puede partirla)
+  std::ifstream f("/proc/self/smaps");
+  string linea;
+  bool dentro = false;
+  size_t total = 0;
+  while (getline(f, linea)) {
+    unsigned long inicio, fin;
+    if (sscanf(linea.c_str(), "%lx-%lx ", &inicio, &fin) == 2) {
+      dentro = (char *) inicio >= base && (char *) fin <= base + bytes;
+      continue;
+    }
+    if (dentro && linea.compare(0, 14, "AnonHugePages:") == 0)
+      total += (size_t) atoll(linea.c_str() + 14) << 10;
+  }
+  return total;
+}
+
+
+const char * Arena::nombre(TipoPaginas paginas)
+{
+  static const char * NOMBRES[NUM_TIPOS_PAGINAS] = { "4k", "2m", "hugetlb" };
+  return NOMBRES[paginas];
+}
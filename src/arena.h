@@ -0,0 +1,189 @@
+/**
+   @file arena.h
+   @brief Arena de memoria alineada y con páginas grandes para vectores y auxiliares.
+   @date 2026-10-17
+*/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+/**
+   Alineación de todos los bloques de una arena: una línea de caché.
+**/
+const size_t ALINEACION_ARENA = 64;
+
+
+/**
+   @brief Tamaño de página con el que se respalda una arena.
+*/
+enum TipoPaginas {
+  PAGINAS_4K,             ///< Páginas normales; se desactivan las transparentes.
+  PAGINAS_2M,             ///< Páginas grandes transparentes (MADV_HUGEPAGE).
+  PAGINAS_HUGETLB,        ///< Páginas grandes reservadas (MAP_HUGETLB).
+  NUM_TIPOS_PAGINAS
+};
+
+
+/**
+   @brief Región de memoria proyectada de la que se reservan bloques en pila.
+
+   La región se proyecta de una vez con mmap y se alinea a 2 MiB. Con
+   PAGINAS_HUGETLB se pide al sistema páginas de /proc/sys/vm/nr_hugepages
+   y, si no hay bastantes, se recurre a PAGINAS_2M. Con PAGINAS_2M el
+   núcleo sólo usa páginas grandes si las transparentes están en modo
+   madvise o always; paginas_grandes() dice cuántos bytes las tienen de
+   verdad.
+
+   Los bloques se reservan uno tras otro, alineados a
+   ALINEACION_ARENA, y se devuelven en cualquier orden: el espacio de
+   un bloque se recupera cuando se han liberado él y todos los
+   posteriores. Es lo que necesitan los auxiliares de los algoritmos,
+   que se reservan y liberan siguiendo la recursión.
+
+   Las páginas se asignan al primer acceso, en el nodo NUMA del hilo que
+   las toca. prefallar() las toca todas desde el hilo que lo llama, de
+   modo que la arena queda en el nodo de ese hilo y los fallos de página
+   no caen dentro de las mediciones.
+
+   Cada reserva y liberación se anota en el perfil de memoria del hilo
+   (anotar_reserva), para que -M las cuente como las de operator new.
+*/
+class Arena {
+public:
+  Arena();
+  ~Arena();
+
+  /**
+     @brief Proyecta una región de al menos bytes bytes.
+     @return false si no se puede, con la descripción en error.
+  */
+  bool abrir(size_t bytes, TipoPaginas paginas, std::string & error);
+
+  void cerrar();
+
+  /**
+     @brief Toca todas las páginas de la región desde el hilo actual.
+  */
+  void prefallar();
+
+  /**
+     @brief Reserva un bloque de bytes bytes alineado a ALINEACION_ARENA.
+     @return NULL si no queda espacio.
+  */
+  void * reservar(size_t bytes);
+
+  /**
+     @brief Libera un bloque reservado con reservar().
+  */
+  void liberar(void * p);
+
+  /**
+     @brief Indica si p apunta dentro de la región.
+  */
+  bool contiene(const void * p) const
+  {
+    return base != NULL && (const char *) p >= base && (const char *) p < base + bytes;
+  }
+
+  /**
+     @brief Tipo de páginas con el que se abrió, tras el posible recurso.
+  */
+  TipoPaginas paginas() const { return tipo; }
+
+  /**
+     @brief Bytes de la región respaldados por páginas grandes.
+  */
+  size_t paginas_grandes() const;
+
+  size_t capacidad() const { return bytes; }
+
+  static const char * nombre(TipoPaginas paginas);
+
+private:
+  char * base;
+  size_t bytes;
+  TipoPaginas tipo;
+
+  struct Bloque {
+    size_t inicio;
+    size_t bytes;
+    bool libre;
+  };
+
+  /**
+     Bloques reservados, en orden.
+  **/
+  std::vector<Bloque> bloques;
+  size_t ocupado;
+
+  Arena(const Arena &);
+  Arena & operator=(const Arena &);
+};
+
+
+/**
+   @brief Arena de la que reservan sus auxiliares los algoritmos del hilo actual.
+   @return NULL si el hilo no tiene arena.
+*/
+Arena * arena_hilo();
+
+/**
+   @brief Fija la arena del hilo actual (NULL para ninguna).
+*/
+void fijar_arena_hilo(Arena * arena);
+
+
+/**
+   @brief Reserva un vector auxiliar de num_elem elementos.
+
+   Lo toma de la arena del hilo actual si tiene y le queda espacio y,
+   si no, de operator new[]. Los elementos quedan sin inicializar. Los
+   tipos no triviales se reservan siempre con new[].
+*/
+template <class Tipo>
+Tipo * reservar_auxiliar(size_t num_elem);
+
+/**
+   @brief Libera un vector reservado con reservar_auxiliar (o NULL).
+*/
+template <class Tipo>
+void liberar_auxiliar(Tipo * p);
+
+
+
+/**
+   Implementación de las funciones
+**/
+
+
+template <class Tipo>
+Tipo * reservar_auxiliar(size_t num_elem)
+{
+  Arena * arena = arena_hilo();
+  if (arena && std::is_trivial<Tipo>::value) {
+    void * p = arena->reservar(num_elem * sizeof(Tipo));
+    if (p)
+      return static_cast<Tipo *>(p);
+  }
+  return new Tipo [num_elem];
+}
+
+
+template <class Tipo>
+void liberar_auxiliar(Tipo * p)
+{
+  Arena * arena = arena_hilo();
+  if (arena && arena->contiene(p))
+    arena->liberar(p);
+  else
+    delete [] p;
+}
+
+
+#endif
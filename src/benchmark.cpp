@@ -0,0 +1,2595 @@
+/**
+   @file benchmark.cpp
+   @brief Banco de pruebas: mide todos los algoritmos en un único proceso.
+   @date 2026-10-17
+
+   Sustituye a los main() de cada algoritmo y a los procesos que
+   lanzaba mide-tiempos.sh por cada tamaño. Recorre la matriz
+   algoritmo x tamaño x muestra reutilizando un único vector alineado
+   y genera los mismos ficheros .dat y las tablas cuadraticos.dat y
+   nlogn.dat.
+
+   Cada punto se mide con el motor de medicion.h: la segunda columna de
+   los .dat es la mediana de las muestras y las siguientes el resto de
+   estadísticos. Con --contadores se añaden, tras los tiempos, las
+   medias por ejecución de los contadores hardware de contadores.h.
+   Con --perfil-memoria se añaden después las reservas de memoria
+   dinámica, el pico de memoria extra y los fallos de página de cada
+   ejecución, medidos con perfil_memoria.h.
+
+   Los algoritmos se instancian para cada tipo de elemento elegido con
+   -t. Los ficheros de float conservan su nombre; los del resto de
+   tipos llevan el tipo como sufijo (quicksort_double.dat,
+   nlogn_double.dat, ...).
+
+   Los vectores de entrada los genera generador.h con la distribución
+   elegida con -d y la semilla de -s, de modo que dos ejecuciones con
+   las mismas opciones miden los mismos vectores. La distribución y la
+   semilla se anotan en la cabecera de cada .dat, y las distribuciones
+   distintas de la uniforme añaden su nombre al sufijo de los ficheros
+   (quicksort_ordenado.dat, nlogn_double_zipf.dat, ...).
+
+   Los algoritmos paralelos usan un planificador con -p hilos. Con
+   --escalado n se mide además cada uno de ellos sobre n elementos con
+   1, 2, ..., p hilos y se escribe la tabla escalado.dat.
+
+   Con --registros n se ordenan n registros de cada tamaño de
+   TAMANIOS_REGISTRO directamente y por índices (indices.h) y se escribe
+   la tabla registros.dat.
+
+   Con --parcial n se buscan los k menores de n elementos con
+   quickselect, ordenacion_parcial y menores_k (parcial.h) para k = 1,
+   10, 100, ..., n, se compara con ordenar el vector entero y se escribe
+   la tabla parcial.dat.
+
+   Con --incremental n se insertan lotes de elementos nuevos en bases
+   ordenadas de hasta n elementos con los contenedores de incremental.h,
+   se compara con volver a ordenar la base entera y se escribe la tabla
+   incremental.dat.
+
+   Los umbrales de inserción de los algoritmos híbridos se leen al
+   empezar de umbrales.cfg (o del fichero de --umbrales), si existe. Con
+   --calibrar n se mide cada híbrido elegido con n elementos y cada
+   umbral de CORTES_CALIBRACION, se queda con el de menor mediana, se
+   escribe calibracion.dat y se guardan los umbrales en ese fichero.
+
+   Con --externo fichero no se hace el barrido: se ordena el fichero
+   con externo.h en la memoria de --memoria, usando el primer algoritmo
+   de -a (o quicksort_robusto) para los tramos, y se escribe externo.dat
+   con el volumen y el caudal de E/S de cada fase.
+
+   Con --datos fichero tampoco se hace el barrido: se proyecta en
+   memoria un fichero de datos de datos.h, se ordena sobre la propia
+   proyección y se escriben en datos.dat por separado el tiempo y los
+   fallos de página de la carga, la ordenación y la escritura.
+
+   Con --verificar tampoco se hace el barrido: se ordenan con cada
+   algoritmo entradas de todas las distribuciones y tipos (o de los de
+   -a, -t y -d) con tamaños de 0 a 4097 elementos y los que rodean a los
+   umbrales, se compara cada resultado con el de std::sort y se termina
+   con error si alguno no coincide. Con cada entrada se comprueban
+   también las funciones de parcial.h con k = 0, 1, n - 1, n y n + 1 y
+   los contenedores de incremental.h con lotes de varios tamaños.
+
+   Cada punto (algoritmo, tamaño) lo mide un hilo fijado con
+   sched_setaffinity a un núcleo físico, que el sistema no puede mover a
+   mitad de medición. Con -j k se miden k puntos a la vez en k núcleos
+   físicos distintos. Para cada punto se anotan en ruido.dat la
+   frecuencia y el gobernador de su CPU, los cambios de contexto
+   involuntarios y la ocupación de las CPU ajenas al barrido, y se
+   marcan como ruidosos los que superan los umbrales de procesador.h.
+   Tras medir cada punto se comprueba que su última ejecución ha
+   ordenado el vector, y el barrido termina con error si alguna no lo ha
+   hecho.
+
+   Con --paginas p los vectores de trabajo y los auxiliares de los
+   algoritmos salen de una arena de arena.h por hilo medidor, respaldada
+   por páginas de 4 KiB, páginas grandes transparentes de 2 MiB o páginas
+   grandes reservadas (hugetlb), y prefallada por su hilo medidor, ya
+   fijado a su núcleo, para que sus páginas queden en el nodo NUMA de
+   ese núcleo. Sin --paginas, vienen de aligned_alloc y new[].
+
+   quicksort_vectorial usa el núcleo de partición más ancho disponible
+   o el elegido con --particion, que se indica al empezar.
+*/
+
+
+#include "algoritmos.h"
+#include "arena.h"
+#include "medicion.h"
+#include "contadores.h"
+#include "perfil_memoria.h"
+#include "planificador.h"
+#include "generador.h"
+#include "umbrales.h"
+#include "externo.h"
+#include "datos.h"
+#include "procesador.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <functional>
+#include <new>
+#include <atomic>
+#include <mutex>
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <getopt.h>
+#include <sys/resource.h>
+
+using std::cout;
+using std::cerr;
+using std::endl;
+using std::string;
+using std::vector;
+using std::map;
+
+
+/* ************************************************************ */
+/*  Registro de algoritmos  */
+
+enum Familia { CUADRATICOS, NLOGN };
+
+template <class Tipo>
+struct Algoritmo {
+  const char * nombre;
+  void (*ordenar)(Tipo T[], Indice num_elem);
+  Familia familia;
+  bool por_defecto;       ///< Se mide si no se indica -a.
+  bool paralelo;          ///< Usa el planificador y entra en escalado.dat.
+};
+
+struct Rango {
+  Indice inicio;
+  Indice fin;
+  Indice salto;
+};
+
+
+/**
+   @brief Planificador de los algoritmos paralelos.
+*/
+static Planificador * planificador = NULL;
+
+
+/**
+   @brief Núcleos físicos en los que se fijan los hilos medidores.
+*/
+static vector<NucleoFisico> nucleos;
+
+
+/**
+   @brief Algoritmos instanciados para el tipo de elemento Tipo.
+
+   El orden y los nombres son los mismos para todos los tipos.
+*/
+template <class Tipo>
+static const vector<Algoritmo<Tipo> > & algoritmos()
+{
+  static const vector<Algoritmo<Tipo> > registro = {
+    { "burbuja",   [](Tipo T[], Indice n) { burbuja(T, n); },
+      CUADRATICOS, true, false },
+    { "insercion", [](Tipo T[], Indice n) { insercion(T, n); },
+      CUADRATICOS, true, false },
+    { "seleccion", [](Tipo T[], Indice n) { seleccion(T, n); },
+      CUADRATICOS, true, false },
+    { "heapsort",  [](Tipo T[], Indice n) { heapsort(T, n); },
+      NLOGN, true, false },
+    { "mergesort", [](Tipo T[], Indice n) { mergesort(T, n); },
+      NLOGN, true, false },
+    { "quicksort", [](Tipo T[], Indice n) { quicksort(T, n); },
+      NLOGN, true, false },
+    { "radix",     [](Tipo T[], Indice n) { radix(T, n); },
+      NLOGN, true, false },
+    { "quicksort_robusto",
+      [](Tipo T[], Indice n) { quicksort_robusto(T, n); },
+      NLOGN, false, false },
+    { "quicksort_vectorial",
+      [](Tipo T[], Indice n) { quicksort_vectorial(T, n); },
+      NLOGN, false, false },
+    { "heapsort_d2", [](Tipo T[], Indice n) { heapsort_dario<2>(T, n); },
+      NLOGN, false, false },
+    { "heapsort_d4", [](Tipo T[], Indice n) { heapsort_dario<4>(T, n); },
+      NLOGN, false, false },
+    { "heapsort_d8", [](Tipo T[], Indice n) { heapsort_dario<8>(T, n); },
+      NLOGN, false, false },
+    { "mergesort_descendente",
+      [](Tipo T[], Indice n) { mergesort_descendente(T, n); },
+      NLOGN, false, false },
+    { "mergesort_ascendente",
+      [](Tipo T[], Indice n) { mergesort_ascendente(T, n); },
+      NLOGN, false, false },
+    { "mergesort_kvias",
+      [](Tipo T[], Indice n) { mergesort_kvias(T, n); },
+      NLOGN, false, false },
+    { "mergesort_natural",
+      [](Tipo T[], Indice n) { mergesort_natural(T, n); },
+      NLOGN, false, false },
+    { "mergesort_paralelo",
+      [](Tipo T[], Indice n) { mergesort_paralelo(T, n, *planificador); },
+      NLOGN, false, true },
+    { "quicksort_paralelo",
+      [](Tipo T[], Indice n) { quicksort_paralelo(T, n, *planificador); },
+      NLOGN, false, true },
+  };
+  return registro;
+}
+
+static const int NUM_ALGORITMOS = algoritmos<float>().size();
+
+static const char * NOMBRE_FAMILIA[] = { "cuadraticos", "nlogn" };
+
+static const Rango RANGO_FAMILIA[] = {
+  { 5000, 125000, 5000 },
+  { 50000, 1250000, 50000 },
+};
+
+const int ALINEACION = 64;
+
+
+/**
+   @brief Resultados de un algoritmo: estadísticos por tamaño.
+*/
+typedef map<Indice, Estadisticos> Serie;
+
+
+/**
+   @brief Opciones del barrido, comunes a todos los tipos de elemento.
+*/
+struct Opciones {
+  vector<bool> seleccion;
+  bool rango_fijo;
+  Rango rango;
+  ConfigMedicion config;
+  string salida;
+  int hilos;
+  int puntos;             ///< Puntos del barrido medidos a la vez.
+  bool afinidad;          ///< Fija cada hilo medidor a un núcleo físico.
+  bool memoria;           ///< Añade el perfil de memoria a los .dat.
+  bool arena;             ///< Reserva los vectores en arenas.
+  TipoPaginas paginas;    ///< Páginas de las arenas.
+  Indice tamanio_escalado; ///< 0 si no se pide la tabla de escalado.
+  Indice tamanio_calibracion; ///< 0 si no se calibran los umbrales.
+  Indice tamanio_registros; ///< 0 si no se pide la tabla de registros.
+  Indice tamanio_parcial; ///< 0 si no se pide la tabla de selección parcial.
+  Indice tamanio_incremental; ///< 0 si no se pide la tabla incremental.
+  string externo;         ///< Fichero a ordenar externamente o "".
+  string datos;           ///< Fichero de datos a ordenar o "".
+  bool en_sitio;          ///< Ordena el fichero de datos en sitio.
+  size_t memoria_externo; ///< Bytes de memoria de la ordenación externa.
+  long long generar;      ///< Elementos que se generan en el fichero o 0.
+  int algoritmo_fichero;  ///< Ordenación de --externo y --datos.
+  Distribucion distribucion;
+  uint64_t semilla;
+};
+
+
+/**
+   @brief Busca un algoritmo por su nombre.
+   @return Índice en el registro o -1 si no existe.
+*/
+static int buscar_algoritmo(const string & nombre)
+{
+  for (int i = 0; i < NUM_ALGORITMOS; i++)
+    if (nombre == algoritmos<float>()[i].nombre)
+      return i;
+  return -1;
+}
+
+
+/**
+   @brief Interpreta una lista de algoritmos separados por comas.
+   @param lista: cadena con los nombres.
+   @param seleccion: índices de los algoritmos elegidos. Es MODIFICADO.
+   @return false si algún nombre no corresponde a un algoritmo.
+*/
+static bool leer_algoritmos(const string & lista, vector<bool> & seleccion)
+{
+  std::stringstream ss(lista);
+  string nombre;
+  seleccion.assign(NUM_ALGORITMOS, false);
+  while (getline(ss, nombre, ',')) {
+    int i = buscar_algoritmo(nombre);
+    if (i < 0) {
+      cerr << "Algoritmo desconocido: " << nombre << endl;
+      return false;
+    }
+    seleccion[i] = true;
+  }
+  return true;
+}
+
+
+/**
+   @brief Interpreta un entero en decimal.
+   @param texto: número.
+   @param v: entero leído. Es MODIFICADO.
+   @param minimo: menor valor admitido.
+   @param maximo: mayor valor admitido.
+   @return false si texto no es un entero entre minimo y maximo.
+*/
+static bool leer_entero(const char * texto, long long & v, long long minimo,
+                        long long maximo)
+{
+  char * fin;
+  errno = 0;
+  long long x = strtoll(texto, &fin, 10);
+  if (errno != 0 || fin == texto || *fin != '\0' || x < minimo || x > maximo)
+    return false;
+  v = x;
+  return true;
+}
+
+
+/**
+   @brief Interpreta un entero de tipo int no menor que minimo.
+*/
+static bool leer_entero(const char * texto, int & v, int minimo)
+{
+  long long x;
+  if (!leer_entero(texto, x, minimo, INT_MAX))
+    return false;
+  v = x;
+  return true;
+}
+
+
+/**
+   @brief Interpreta un tamaño de 64 bits.
+   @param texto: número de elementos en decimal.
+   @param n: tamaño leído. Es MODIFICADO.
+   @param maximo: mayor tamaño admitido.
+   @return false si texto no es un entero entre 1 y maximo.
+*/
+static bool leer_tamanio(const char * texto, Indice & n,
+                         Indice maximo = PTRDIFF_MAX)
+{
+  long long v;
+  if (!leer_entero(texto, v, 1, maximo))
+    return false;
+  n = v;
+  return true;
+}
+
+
+/**
+   @brief Interpreta un número real.
+   @return false si texto no es un número finito mayor que 0.
+*/
+static bool leer_real(const char * texto, double & v)
+{
+  char * fin;
+  errno = 0;
+  double x = strtod(texto, &fin);
+  if (errno != 0 || fin == texto || *fin != '\0' || !std::isfinite(x) ||
+      x <= 0)
+    return false;
+  v = x;
+  return true;
+}
+
+
+/**
+   @brief Interpreta un rango de tamaños con formato inicio:fin:salto.
+   @return false si el formato no es válido.
+*/
+static bool leer_rango(const char * texto, Rango & r)
+{
+  if (sscanf(texto, "%td:%td:%td", &r.inicio, &r.fin, &r.salto) != 3)
+    return false;
+  return r.inicio > 0 && r.fin >= r.inicio && r.salto > 0;
+}
+
+
+/* ************************************************************ */
+/*  Medición y salida  */
+
+/**
+   @brief Mide la ordenación de vectores generados con una distribución.
+
+   @param alg: algoritmo a medir.
+   @param T: vector de trabajo con al menos num_elem elementos.
+   @param num_elem: tamaño del vector a ordenar.
+   @param generador: generador de las entradas. Es MODIFICADO.
+   @param semilla: semilla del barrido.
+   @param config: parámetros de la medición.
+   @param reloj: reloj con el que se mide.
+   @param contadores: contadores hardware o NULL. Es MODIFICADO.
+   @param memoria: perfil de memoria o NULL. Es MODIFICADO.
+
+   El generador se reinicia con una semilla que sólo depende de la del
+   barrido y de num_elem, así que todos los algoritmos reciben la misma
+   secuencia de entradas para cada tamaño.
+*/
+template <class Tipo>
+static Estadisticos medir_algoritmo(const Algoritmo<Tipo> & alg, Tipo T[],
+                                    Indice num_elem, Generador & generador,
+                                    uint64_t semilla,
+                                    const ConfigMedicion & config,
+                                    const Reloj & reloj,
+                                    ContadoresHW * contadores,
+                                    PerfilMemoria * memoria)
+{
+  generador.reiniciar(semilla ^ ((uint64_t) num_elem * 0x9E3779B97F4A7C15ULL));
+  return medir([&]() { generador.rellenar(T, num_elem); },
+               [&]() { alg.ordenar(T, num_elem); },
+               config, reloj, contadores, memoria);
+}
+
+
+/**
+   @brief Escribe una celda de tabla con el formato "%-10s" de mide-tiempos.sh.
+
+   Se garantiza al menos un espacio tras el valor para que las columnas
+   no se junten cuando el número ocupa diez caracteres o más.
+*/
+template <class Valor>
+static void celda(std::ostream & os, const Valor & v)
+{
+  std::ostringstream ss;
+  ss << v;
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%-9s ", ss.str().c_str());
+  os << buf;
+}
+
+
+/**
+   @brief Escribe la tabla compartida de una familia de algoritmos.
+
+   Una columna con el tamaño y otra por cada algoritmo medido de la
+   familia, en el orden del registro.
+*/
+static void escribir_tabla(const Opciones & op, const string & sufijo,
+                           Familia familia, const vector<Serie> & series)
+{
+  vector<int> columnas;
+  for (int a = 0; a < NUM_ALGORITMOS; a++)
+    if (op.seleccion[a] && algoritmos<float>()[a].familia == familia)
+      columnas.push_back(a);
+  if (columnas.empty())
+    return;
+
+  string fichero = op.salida + "/" + NOMBRE_FAMILIA[familia] + sufijo + ".dat";
+  std::ofstream f(fichero.c_str());
+  if (!f) {
+    cerr << "No se puede escribir " << fichero << endl;
+    return;
+  }
+
+  f << endl;
+  const Serie & primera = series[columnas[0]];
+  for (Serie::const_iterator it = primera.begin(); it != primera.end(); ++it) {
+    celda(f, it->first);
+    for (size_t c = 0; c < columnas.size(); c++) {
+      const Serie & s = series[columnas[c]];
+      Serie::const_iterator v = s.find(it->first);
+      if (v != s.end())
+        celda(f, v->second.mediana);
+      else
+        celda(f, "-");
+    }
+    f << endl;
+  }
+}
+
+
+/**
+   @brief Resultado de la medición de un punto (algoritmo, tamaño).
+*/
+struct Punto {
+  int algoritmo;
+  Indice n;
+  Estadisticos e;
+  double eventos[NUM_EVENTOS];  ///< Medias por ejecución; < 0 si no disponible.
+  double memoria[NUM_MEDIDAS_MEMORIA];  ///< < 0 si no disponible.
+  int cpu;                      ///< CPU lógica del hilo medidor o -1.
+  string gobernador;
+  Ruido ruido;
+  bool ordenado;                ///< La última ejecución medida ha ordenado.
+};
+
+
+/**
+   @brief Escribe la cabecera de un fichero .dat de algoritmo.
+*/
+static void escribir_cabecera(std::ostream & os, const Opciones & op,
+                              const Generador & generador,
+                              const Reloj & reloj, bool contadores,
+                              bool memoria)
+{
+  os << "# distribucion " << generador.descripcion() << ", semilla "
+     << op.semilla;
+  if (op.arena)
+    os << ", paginas " << Arena::nombre(op.paginas);
+  os << endl;
+  os << "# n\tmediana\tminimo\tp90\tp99\tmedia\tdesviacion\tic_inf\tic_sup"
+     << "\tmuestras\tatipicos";
+  if (contadores)
+    for (int e = 0; e < NUM_EVENTOS; e++)
+      os << "\t" << ContadoresHW::nombre(Evento(e));
+  if (memoria)
+    for (int m = 0; m < NUM_MEDIDAS_MEMORIA; m++)
+      os << "\t" << PerfilMemoria::nombre(MedidaMemoria(m));
+  os << " (segundos, reloj " << reloj.nombre() << ")" << endl;
+}
+
+
+/**
+   @brief Escribe una fila de un fichero .dat de algoritmo.
+*/
+static void escribir_fila(std::ostream & os, const Punto & p, bool contadores,
+                          bool memoria)
+{
+  const Estadisticos & e = p.e;
+  os << p.n << "\t" << e.mediana << "\t" << e.minimo << "\t" << e.p90
+     << "\t" << e.p99 << "\t" << e.media << "\t" << e.desviacion
+     << "\t" << e.ic_inf << "\t" << e.ic_sup << "\t" << e.muestras
+     << "\t" << e.atipicos;
+  if (contadores)
+    for (int ev = 0; ev < NUM_EVENTOS; ev++) {
+      if (p.eventos[ev] >= 0)
+        os << "\t" << (long long) p.eventos[ev];
+      else
+        os << "\t-";
+    }
+  if (memoria)
+    for (int m = 0; m < NUM_MEDIDAS_MEMORIA; m++) {
+      if (p.memoria[m] >= 0)
+        os << "\t" << (long long) p.memoria[m];
+      else
+        os << "\t-";
+    }
+  os << endl;
+}
+
+
+/**
+   @brief Escribe las filas del .dat de un algoritmo, en orden de tamaño.
+*/
+static void escribir_filas(std::ostream & os, const vector<Punto> & puntos,
+                           int algoritmo, bool contadores, bool memoria)
+{
+  for (size_t i = 0; i < puntos.size(); i++)
+    if (puntos[i].algoritmo == algoritmo)
+      escribir_fila(os, puntos[i], contadores, memoria);
+  os.flush();
+}
+
+
+/**
+   @brief Escribe el estado del procesador durante cada punto medido.
+   @return Número de puntos ruidosos, o -1 si no se puede escribir.
+*/
+static int escribir_ruido(const string & fichero, const vector<Punto> & puntos)
+{
+  std::ofstream f(fichero.c_str());
+  if (!f) {
+    cerr << "No se puede escribir " << fichero << endl;
+    return -1;
+  }
+
+  int ruidosos = 0;
+  f << "# algoritmo\tn\tcpu\tgobernador\tmhz_inicio\tmhz_fin\tinvoluntarios"
+    << "\tocupacion_ajena\truidoso" << endl;
+  for (size_t i = 0; i < puntos.size(); i++) {
+    const Punto & p = puntos[i];
+    f << algoritmos<float>()[p.algoritmo].nombre << "\t" << p.n << "\t";
+    if (p.cpu >= 0)
+      f << p.cpu;
+    else
+      f << "-";
+    f << "\t" << p.gobernador << "\t" << p.ruido.mhz_inicio << "\t"
+      << p.ruido.mhz_fin << "\t" << p.ruido.involuntarios << "\t"
+      << p.ruido.ocupacion_ajena << "\t" << p.ruido.ruidoso << endl;
+    ruidosos += p.ruido.ruidoso;
+  }
+  return ruidosos;
+}
+
+
+/**
+   @brief Mide un punto del barrido y el estado del procesador mientras.
+
+   @param alg: algoritmo a medir.
+   @param p: punto, con n y cpu ya rellenos. Es MODIFICADO.
+   @param T: vector de trabajo con al menos p.n elementos.
+   @param generador: generador de las entradas. Es MODIFICADO.
+   @param op: opciones del barrido.
+   @param reloj: reloj con el que se mide.
+   @param contadores: contadores hardware del hilo actual o NULL.
+                      Es MODIFICADO.
+   @param memoria: perfil de memoria o NULL. Es MODIFICADO.
+   @param reservadas: CPU lógicas en las que miden los hilos del barrido.
+
+   Tras medir comprueba, fuera del tiempo medido, que la última
+   ejecución ha dejado T ordenado.
+*/
+template <class Tipo>
+static void medir_punto(const Algoritmo<Tipo> & alg, Punto & p, Tipo T[],
+                        Generador & generador, const Opciones & op,
+                        const Reloj & reloj, ContadoresHW * contadores,
+                        PerfilMemoria * memoria,
+                        const vector<bool> & reservadas)
+{
+  p.gobernador = p.cpu >= 0 ? gobernador(p.cpu) : "-";
+  double mhz = p.cpu >= 0 ? frecuencia_mhz(p.cpu) : 0;
+  Instantanea antes = instantanea();
+  p.e = medir_algoritmo(alg, T, p.n, generador, op.semilla, op.config,
+                        reloj, contadores, memoria);
+  Instantanea despues = instantanea();
+  p.ordenado = std::is_sorted(T, T + p.n);
+  p.ruido = comparar(antes, despues, reservadas, mhz,
+                     p.cpu >= 0 ? frecuencia_mhz(p.cpu) : 0);
+  for (int ev = 0; ev < NUM_EVENTOS; ev++)
+    p.eventos[ev] = contadores && contadores->disponible(Evento(ev)) ?
+                    contadores->media(Evento(ev)) : -1;
+  for (int m = 0; m < NUM_MEDIDAS_MEMORIA; m++)
+    p.memoria[m] = memoria && memoria->disponible(MedidaMemoria(m)) ?
+                   memoria->valor(MedidaMemoria(m)) : -1;
+}
+
+
+/**
+   @brief Coste relativo estimado de un punto, para repartir primero los
+   más caros entre los hilos medidores.
+*/
+static double coste(Familia familia, Indice n)
+{
+  return familia == CUADRATICOS ? (double) n * n : n * std::log2((double) n);
+}
+
+
+/**
+   @brief Comprueba antes de reservarlos que caben bytes bytes en la
+   memoria disponible.
+   @return false, tras indicarlo, si no caben.
+*/
+static bool cabe(size_t bytes, Indice num_elem)
+{
+  size_t disponible = memoria_disponible();
+  if (disponible == 0 || bytes <= disponible)
+    return true;
+  cerr << "Medir con " << num_elem << " elementos necesita unos "
+       << (bytes >> 20) << " MiB y sólo hay " << (disponible >> 20)
+       << " MiB disponibles" << endl;
+  return false;
+}
+
+
+/**
+   @brief Memoria que necesita un hilo medidor con vectores de num_elem
+   elementos: el vector, hasta dos veces más de auxiliares y las claves
+   de 64 bits del generador.
+*/
+template <class Tipo>
+static size_t bytes_medicion(Indice num_elem)
+{
+  return (size_t) num_elem * (3 * sizeof(Tipo) + sizeof(uint64_t));
+}
+
+
+/**
+   @brief Bytes de la arena de un hilo medidor cuyo vector de trabajo
+   ocupa bytes: el vector y los auxiliares, que nunca pasan del doble
+   (los de mergesort, sumados a lo largo de la recursión).
+*/
+static size_t bytes_arena(size_t bytes)
+{
+  return 3 * bytes + 128 * ALINEACION_ARENA;
+}
+
+
+/**
+   @brief Mide todos los algoritmos elegidos para el tipo de elemento Tipo.
+
+   @param op: opciones del barrido.
+   @param sufijo: sufijo de los ficheros de salida de este tipo.
+   @param reloj: reloj con el que se mide.
+   @param contadores: contadores hardware o NULL. Es MODIFICADO.
+   @return 0 si todo fue bien, -1 en caso de error.
+
+   Los puntos (algoritmo, tamaño) de los algoritmos secuenciales los
+   miden op.puntos hilos a la vez, cada uno fijado a un núcleo físico
+   distinto (salvo sin op.afinidad) y con su propio vector, generador,
+   contadores y perfil de memoria, que sólo cuenta las reservas de su
+   hilo. Con más de un hilo se reparten primero los puntos más
+   caros. Los algoritmos paralelos se miden después, de uno en uno,
+   desde el hilo principal, y su perfil de memoria cuenta las reservas
+   de todos los hilos. El pico de memoria residente es del proceso, así
+   que sólo se mide si hay un único hilo medidor. Las filas de cada
+   .dat se escriben en cuanto se terminan todos sus puntos y
+   ruido<sufijo>.dat al final.
+*/
+template <class Tipo>
+static int barrido(const Opciones & op, const string & sufijo,
+                   const Reloj & reloj, ContadoresHW * contadores)
+{
+  const vector<Algoritmo<Tipo> > & algs = algoritmos<Tipo>();
+
+  // Rango de cada algoritmo y tamaño de los vectores de trabajo
+  vector<Rango> rangos(NUM_ALGORITMOS);
+  Indice tamanio_maximo = 0;
+  for (int a = 0; a < NUM_ALGORITMOS; a++) {
+    rangos[a] = op.rango_fijo ? op.rango : RANGO_FAMILIA[algs[a].familia];
+    if (op.seleccion[a] && rangos[a].fin > tamanio_maximo)
+      tamanio_maximo = rangos[a].fin;
+  }
+
+  // Puntos en el orden de los ficheros
+  vector<Punto> puntos;
+  vector<int> pendientes(NUM_ALGORITMOS, 0);
+  vector<size_t> secuenciales, paralelos;
+  for (int a = 0; a < NUM_ALGORITMOS; a++) {
+    if (!op.seleccion[a])
+      continue;
+    for (Indice n = rangos[a].inicio; n <= rangos[a].fin; n += rangos[a].salto) {
+      Punto p;
+      p.algoritmo = a;
+      p.n = n;
+      p.cpu = -1;
+      (algs[a].paralelo ? paralelos : secuenciales).push_back(puntos.size());
+      puntos.push_back(p);
+      pendientes[a]++;
+    }
+  }
+
+  // Hilos medidores y CPU lógicas en las que miden
+  int hilos = std::min<size_t>(op.puntos, secuenciales.size());
+  if (op.afinidad)
+    hilos = std::min<size_t>(hilos, nucleos.size());
+  vector<bool> reservadas, todas;
+  for (size_t c = 0; c < nucleos.size(); c++)
+    for (size_t h = 0; h < nucleos[c].hermanos.size(); h++) {
+      size_t cpu = nucleos[c].hermanos[h];
+      if (todas.size() <= cpu) {
+        todas.resize(cpu + 1, false);
+        reservadas.resize(cpu + 1, false);
+      }
+      todas[cpu] = true;
+      reservadas[cpu] = !op.afinidad || (cpu == (size_t) nucleos[c].cpu &&
+                                         (int) c < hilos);
+    }
+  if (hilos > 1)
+    std::stable_sort(secuenciales.begin(), secuenciales.end(),
+                     [&](size_t i, size_t j) {
+      return coste(algs[puntos[i].algoritmo].familia, puntos[i].n) >
+             coste(algs[puntos[j].algoritmo].familia, puntos[j].n);
+    });
+
+  size_t bytes = (size_t) tamanio_maximo * sizeof(Tipo);
+  bytes = (bytes + ALINEACION - 1) / ALINEACION * ALINEACION;
+  if (!cabe(std::max(hilos, 1) * bytes_medicion<Tipo>(tamanio_maximo),
+            tamanio_maximo))
+    return -1;
+  vector<Tipo *> vectores(std::max(hilos, 1), (Tipo *) NULL);
+  vector<Arena *> arenas;
+  auto liberar = [&]() {
+    for (size_t w = 0; w < vectores.size() && arenas.empty(); w++)
+      free(vectores[w]);
+    for (size_t w = 0; w < arenas.size(); w++)
+      delete arenas[w];
+  };
+  for (size_t w = 0; w < vectores.size(); w++) {
+    if (op.arena) {
+      string error;
+      arenas.push_back(new Arena);
+      if (!arenas[w]->abrir(bytes_arena(bytes), op.paginas, error)) {
+        cerr << "Arena: " << error << endl;
+        liberar();
+        return -1;
+      }
+      vectores[w] = static_cast<Tipo *>(arenas[w]->reservar(bytes));
+    } else {
+      vectores[w] = static_cast<Tipo *>(aligned_alloc(ALINEACION, bytes));
+    }
+    if (vectores[w] == NULL) {
+      cerr << "No hay memoria para " << tamanio_maximo << " elementos" << endl;
+      liberar();
+      return -1;
+    }
+  }
+  if (op.arena && arenas[0]->paginas() != op.paginas)
+    cerr << "No hay páginas " << Arena::nombre(op.paginas) << " reservadas; "
+         << "se usan páginas " << Arena::nombre(arenas[0]->paginas()) << endl;
+
+  Generador generador(op.distribucion, op.semilla);
+  vector<std::ofstream> ficheros(NUM_ALGORITMOS);
+  for (int a = 0; a < NUM_ALGORITMOS; a++) {
+    if (!op.seleccion[a])
+      continue;
+    string fichero = op.salida + "/" + algs[a].nombre + sufijo + ".dat";
+    ficheros[a].open(fichero.c_str());
+    if (!ficheros[a]) {
+      cerr << "No se puede escribir " << fichero << endl;
+      liberar();
+      return -1;
+    }
+    escribir_cabecera(ficheros[a], op, generador, reloj, contadores != NULL,
+                      op.memoria);
+  }
+
+  cout << "Midiendo el tiempo de " << puntos.size() << " puntos" << sufijo;
+  if (hilos > 1)
+    cout << ", " << hilos << " a la vez";
+  cout << ":" << endl;
+
+  // Se llama con m tomado
+  std::mutex m;
+  auto terminado = [&](const Punto & p) {
+    cout << "\t" << algs[p.algoritmo].nombre << sufijo << " con " << p.n
+         << " elementos";
+    if (p.cpu >= 0)
+      cout << " (cpu " << p.cpu << ")";
+    if (p.ruido.ruidoso)
+      cout << " RUIDOSO";
+    if (!p.ordenado)
+      cout << " DESORDENADO";
+    cout << endl;
+    if (--pendientes[p.algoritmo] == 0)
+      escribir_filas(ficheros[p.algoritmo], puntos, p.algoritmo,
+                     contadores != NULL, op.memoria);
+  };
+
+  std::atomic<size_t> siguiente(0);
+  auto medidor = [&](int w) {
+    int cpu = op.afinidad ? nucleos[w].cpu : -1;
+    if (cpu >= 0 && !fijar_hilo(cpu)) {
+      std::lock_guard<std::mutex> l(m);
+      cerr << "No se puede fijar un hilo a la cpu " << cpu << endl;
+      cpu = -1;
+    }
+    // Primer acceso a la arena desde el núcleo que la va a usar
+    if (op.arena) {
+      arenas[w]->prefallar();
+      fijar_arena_hilo(arenas[w]);
+    }
+    // Los contadores cuentan los eventos del hilo que los abre
+    Generador propio(op.distribucion, op.semilla);
+    ContadoresHW * eventos = contadores ? new ContadoresHW : NULL;
+    PerfilMemoria * memoria = op.memoria ?
+                              new PerfilMemoria(MEMORIA_HILO, hilos == 1) : NULL;
+    size_t i;
+    while ((i = siguiente++) < secuenciales.size()) {
+      Punto & p = puntos[secuenciales[i]];
+      p.cpu = cpu;
+      medir_punto(algs[p.algoritmo], p, vectores[w], propio, op, reloj,
+                  eventos, memoria, reservadas);
+      std::lock_guard<std::mutex> l(m);
+      terminado(p);
+    }
+    delete eventos;
+    delete memoria;
+    fijar_arena_hilo(NULL);
+  };
+
+  vector<std::thread> medidores;
+  for (int w = 0; w < hilos; w++)
+    medidores.push_back(std::thread(medidor, w));
+  for (size_t w = 0; w < medidores.size(); w++)
+    medidores[w].join();
+
+  if (op.arena) {
+    if (hilos == 0)
+      arenas[0]->prefallar();
+    cout << "Arena de " << (arenas[0]->capacidad() >> 20) << " MiB por hilo, "
+         << (arenas[0]->paginas_grandes() >> 20) << " MiB en páginas grandes"
+         << endl;
+    fijar_arena_hilo(arenas[0]);
+  }
+
+  // Los paralelos usan todos los hilos del planificador
+  PerfilMemoria proceso(MEMORIA_PROCESO);
+  for (size_t i = 0; i < paralelos.size(); i++) {
+    Punto & p = puntos[paralelos[i]];
+    medir_punto(algs[p.algoritmo], p, vectores[0], generador, op, reloj,
+                contadores, op.memoria ? &proceso : NULL, todas);
+    terminado(p);
+  }
+  cout << endl;
+
+  fijar_arena_hilo(NULL);
+  liberar();
+
+  // Creación de las tablas compartidas
+  vector<Serie> series(NUM_ALGORITMOS);
+  for (size_t i = 0; i < puntos.size(); i++)
+    series[puntos[i].algoritmo][puntos[i].n] = puntos[i].e;
+  escribir_tabla(op, sufijo, CUADRATICOS, series);
+  escribir_tabla(op, sufijo, NLOGN, series);
+
+  int ruidosos = escribir_ruido(op.salida + "/ruido" + sufijo + ".dat", puntos);
+  if (ruidosos < 0)
+    return -1;
+  if (ruidosos > 0)
+    cout << ruidosos << " de " << puntos.size() << " puntos medidos con "
+         << "ruido (ruido" << sufijo << ".dat)" << endl << endl;
+
+  int desordenados = 0;
+  for (size_t i = 0; i < puntos.size(); i++)
+    if (!puntos[i].ordenado) {
+      cerr << "Error: " << algs[puntos[i].algoritmo].nombre << sufijo
+           << " no ha ordenado " << puntos[i].n << " elementos" << endl;
+      desordenados++;
+    }
+  return desordenados == 0 ? 0 : -1;
+}
+
+
+/**
+   @brief Mide los algoritmos paralelos con 1, 2, ..., op.hilos hilos.
+
+   Escribe escalado.dat con una fila por número de hilos y, para cada
+   algoritmo paralelo, la mediana del tiempo y la aceleración respecto
+   a un hilo.
+*/
+static int escalado(const Opciones & op, const Reloj & reloj)
+{
+  const vector<Algoritmo<float> > & algs = algoritmos<float>();
+  Indice n = op.tamanio_escalado;
+
+  // Los paralelos elegidos con -a o, si no hay ninguno, todos
+  vector<int> columnas;
+  for (int a = 0; a < NUM_ALGORITMOS; a++)
+    if (algs[a].paralelo && op.seleccion[a])
+      columnas.push_back(a);
+  for (int a = 0; a < NUM_ALGORITMOS && columnas.empty(); a++)
+    if (algs[a].paralelo)
+      columnas.push_back(a);
+
+  string fichero = op.salida + "/escalado.dat";
+  std::ofstream f(fichero.c_str());
+  if (!f) {
+    cerr << "No se puede escribir " << fichero << endl;
+    return -1;
+  }
+
+  if (!cabe(bytes_medicion<float>(n), n))
+    return -1;
+  float * T = static_cast<float *>(aligned_alloc(ALINEACION,
+      ((size_t) n * sizeof(float) + ALINEACION - 1) / ALINEACION * ALINEACION));
+  if (T == NULL) {
+    cerr << "No hay memoria para " << n << " elementos" << endl;
+    return -1;
+  }
+
+  Generador generador(op.distribucion, op.semilla);
+  cout << "Escalado con " << n << " elementos:" << endl;
+  f << "# distribucion " << generador.descripcion() << ", semilla "
+    << op.semilla << endl;
+  f << "# hilos";
+  for (size_t c = 0; c < columnas.size(); c++)
+    f << "\t" << algs[columnas[c]].nombre << "\taceleracion";
+  f << " (n = " << n << ", segundos)" << endl;
+
+  Planificador * anterior = planificador;
+  vector<double> base(columnas.size());
+  for (int h = 1; h <= op.hilos; h++) {
+    cout << "\t" << h << " hilos" << endl;
+    Planificador p(h);
+    planificador = &p;
+    f << h;
+    for (size_t c = 0; c < columnas.size(); c++) {
+      Estadisticos e = medir_algoritmo(algs[columnas[c]], T, n, generador,
+                                       op.semilla, op.config, reloj, NULL,
+                                       NULL);
+      if (h == 1)
+        base[c] = e.mediana;
+      f << "\t" << e.mediana << "\t" << base[c] / e.mediana;
+    }
+    f << endl;
+  }
+  planificador = anterior;
+  cout << endl;
+
+  free(T);
+  return 0;
+}
+
+
+/**
+   @brief Formas de ordenar los registros que compara registros.dat.
+*/
+enum FormaRegistros {
+  DIRECTO_QUICKSORT,      ///< quicksort_robusto sobre los registros.
+  DIRECTO_MERGESORT,      ///< mergesort_ascendente sobre los registros.
+  INDICES_QUICKSORT,      ///< ordenar_por_clave con quicksort_robusto.
+  INDICES_RADIX,          ///< ordenar_por_clave con radix.
+  INDICES_REUNIR,         ///< argsort con radix y reunir en el auxiliar.
+  NUM_FORMAS_REGISTROS
+};
+
+static const char * NOMBRE_FORMA_REGISTROS[] = {
+  "directo_quicksort", "directo_mergesort", "indices_quicksort",
+  "indices_radix", "argsort_reunir"
+};
+
+
+/**
+   @brief Mide cada forma de ordenar n registros de Bytes bytes.
+
+   @param op: opciones del barrido.
+   @param reloj: reloj con el que se mide.
+   @param claves: las n claves de la entrada.
+   @param medianas: mediana de cada FormaRegistros. Es MODIFICADO.
+   @return false si no hay memoria.
+
+   Todas las formas ordenan la misma entrada, que se restaura antes de
+   cada ejecución, y comparten el vector auxiliar. INDICES_REUNIR deja
+   el resultado en el auxiliar, sin copiarlo de vuelta.
+*/
+template <int Bytes>
+static bool medir_registros(const Opciones & op, const Reloj & reloj,
+                            const float claves[], vector<double> & medianas)
+{
+  typedef RegistroCarga<Bytes> R;
+  Indice n = op.tamanio_registros;
+  R * original = new (std::nothrow) R [n];
+  R * T = new (std::nothrow) R [n];
+  R * aux = new (std::nothrow) R [n];
+  uint32_t * perm = new (std::nothrow) uint32_t [n];
+  if (original == NULL || T == NULL || aux == NULL || perm == NULL) {
+    delete [] original;
+    delete [] T;
+    delete [] aux;
+    delete [] perm;
+    return false;
+  }
+  for (Indice i = 0; i < n; i++) {
+    original[i].clave = claves[i];
+    std::fill(original[i].carga, original[i].carga + (Bytes - 4) / 4,
+              (uint32_t) i);
+  }
+
+  auto clave = [](const R & r) { return r.clave; };
+  auto quicksort_pares = [](ClaveIndice P[], Indice m) { quicksort_robusto(P, m); };
+  medianas.assign(NUM_FORMAS_REGISTROS, 0);
+  for (int f = 0; f < NUM_FORMAS_REGISTROS; f++) {
+    std::function<void()> ordenar;
+    switch (f) {
+    case DIRECTO_QUICKSORT:
+      ordenar = [&]() { quicksort_robusto(T, n); };
+      break;
+    case DIRECTO_MERGESORT:
+      ordenar = [&]() { mergesort_ascendente(T, n, aux); };
+      break;
+    case INDICES_QUICKSORT:
+      ordenar = [&]() { ordenar_por_clave(T, n, clave, quicksort_pares, aux); };
+      break;
+    case INDICES_RADIX:
+      ordenar = [&]() { ordenar_por_clave(T, n, clave, RadixPares(), aux); };
+      break;
+    default:
+      ordenar = [&]() {
+        argsort(T, n, perm, clave);
+        reunir(T, aux, perm, n);
+      };
+      break;
+    }
+    Estadisticos e = medir([&]() { std::copy(original, original + n, T); },
+                           ordenar, op.config, reloj);
+    medianas[f] = e.mediana;
+  }
+
+  delete [] original;
+  delete [] T;
+  delete [] aux;
+  delete [] perm;
+  return true;
+}
+
+
+/**
+   @brief Tamaños de registro de registros.dat.
+*/
+static const struct {
+  int bytes;
+  bool (*medir)(const Opciones & op, const Reloj & reloj,
+                const float claves[], vector<double> & medianas);
+} TAMANIOS_REGISTRO[] = {
+  { 8,   medir_registros<8> },
+  { 16,  medir_registros<16> },
+  { 32,  medir_registros<32> },
+  { 64,  medir_registros<64> },
+  { 128, medir_registros<128> },
+  { 256, medir_registros<256> },
+};
+
+
+/**
+   @brief Compara la ordenación directa de registros con la ordenación
+   por índices de indices.h para cada tamaño de TAMANIOS_REGISTRO.
+
+   Escribe registros.dat con una fila por tamaño de registro, la mediana
+   de cada FormaRegistros y la aceleración de la mejor ordenación por
+   índices respecto a quicksort_robusto directo.
+*/
+static int registros(const Opciones & op, const Reloj & reloj)
+{
+  Indice n = op.tamanio_registros;
+  // Los del mayor tamaño, su copia, el auxiliar, los pares y la permutación
+  const Indice bytes = TAMANIOS_REGISTRO[sizeof(TAMANIOS_REGISTRO) /
+                                         sizeof(TAMANIOS_REGISTRO[0]) - 1].bytes;
+  if (!cabe(n * (3 * bytes + sizeof(ClaveIndice) + sizeof(uint32_t) +
+                 sizeof(float)), n))
+    return -1;
+  string fichero = op.salida + "/registros.dat";
+  std::ofstream f(fichero.c_str());
+  if (!f) {
+    cerr << "No se puede escribir " << fichero << endl;
+    return -1;
+  }
+
+  vector<float> claves(n);
+  Generador generador(op.distribucion, op.semilla);
+  generador.rellenar(&claves[0], n);
+
+  cout << "Registros con " << n << " elementos:" << endl;
+  f << "# distribucion " << generador.descripcion() << ", semilla "
+    << op.semilla << endl;
+  f << "# bytes";
+  for (int c = 0; c < NUM_FORMAS_REGISTROS; c++)
+    f << "\t" << NOMBRE_FORMA_REGISTROS[c];
+  f << "\taceleracion (n = " << n << ", segundos)" << endl;
+
+  for (size_t t = 0; t < sizeof(TAMANIOS_REGISTRO) / sizeof(TAMANIOS_REGISTRO[0]); t++) {
+    cout << "\t" << TAMANIOS_REGISTRO[t].bytes << " bytes" << endl;
+    vector<double> medianas;
+    if (!TAMANIOS_REGISTRO[t].medir(op, reloj, &claves[0], medianas)) {
+      cerr << "No hay memoria para " << n << " registros de "
+           << TAMANIOS_REGISTRO[t].bytes << " bytes" << endl;
+      return -1;
+    }
+    f << TAMANIOS_REGISTRO[t].bytes;
+    for (int c = 0; c < NUM_FORMAS_REGISTROS; c++)
+      f << "\t" << medianas[c];
+    f << "\t" << medianas[DIRECTO_QUICKSORT] /
+                 *std::min_element(medianas.begin() + INDICES_QUICKSORT,
+                                   medianas.end())
+      << endl;
+  }
+  cout << endl;
+
+  return 0;
+}
+
+
+/**
+   @brief Formas de obtener los k menores que compara parcial.dat.
+*/
+enum FormaParcial {
+  PARCIAL_QUICKSORT,      ///< quicksort_robusto de todo el vector.
+  PARCIAL_QUICKSELECT,    ///< quickselect del k-ésimo menor.
+  PARCIAL_ORDENACION,     ///< ordenacion_parcial de los k menores.
+  PARCIAL_MONTON,         ///< menores_k, sin modificar la entrada.
+  NUM_FORMAS_PARCIAL
+};
+
+static const char * NOMBRE_FORMA_PARCIAL[] = {
+  "quicksort_robusto", "quickselect", "ordenacion_parcial", "menores_k"
+};
+
+
+/**
+   @brief Compara la selección y la ordenación parcial de parcial.h con
+   la ordenación completa para k = 1, 10, 100, ..., n.
+
+   Escribe parcial.dat con una fila por k, la mediana de cada
+   FormaParcial y la aceleración de la más rápida de ordenacion_parcial
+   y menores_k, que dan los k menores en orden, respecto a ordenar todo
+   el vector. La ordenación completa no depende de k y se mide una vez.
+*/
+static int parcial(const Opciones & op, const Reloj & reloj)
+{
+  Indice n = op.tamanio_parcial;
+  if (!cabe(bytes_medicion<float>(n), n))
+    return -1;
+  string fichero = op.salida + "/parcial.dat";
+  std::ofstream f(fichero.c_str());
+  if (!f) {
+    cerr << "No se puede escribir " << fichero << endl;
+    return -1;
+  }
+
+  float * original = new (std::nothrow) float [n];
+  float * T = new (std::nothrow) float [n];
+  float * salida = new (std::nothrow) float [n];
+  if (original == NULL || T == NULL || salida == NULL) {
+    cerr << "No hay memoria para " << n << " elementos" << endl;
+    delete [] original;
+    delete [] T;
+    delete [] salida;
+    return -1;
+  }
+  Generador generador(op.distribucion, op.semilla);
+  generador.rellenar(original, n);
+  auto restaurar = [&]() { std::copy(original, original + n, T); };
+
+  cout << "Selección parcial con " << n << " elementos:" << endl;
+  f << "# distribucion " << generador.descripcion() << ", semilla "
+    << op.semilla << endl;
+  f << "# k";
+  for (int c = 0; c < NUM_FORMAS_PARCIAL; c++)
+    f << "\t" << NOMBRE_FORMA_PARCIAL[c];
+  f << "\taceleracion (n = " << n << ", segundos)" << endl;
+
+  double completa = medir(restaurar, [&]() { quicksort_robusto(T, n); },
+                          op.config, reloj).mediana;
+  for (Indice k = 1; ; k = std::min<Indice>(10 * k, n)) {
+    cout << "\tk = " << k << endl;
+    vector<double> medianas(NUM_FORMAS_PARCIAL, completa);
+    for (int c = PARCIAL_QUICKSELECT; c < NUM_FORMAS_PARCIAL; c++) {
+      std::function<void()> ejecutar;
+      switch (c) {
+      case PARCIAL_QUICKSELECT:
+        ejecutar = [&]() { quickselect(T, n, k - 1); };
+        break;
+      case PARCIAL_ORDENACION:
+        ejecutar = [&]() { ordenacion_parcial(T, n, k); };
+        break;
+      default:
+        ejecutar = [&]() { menores_k(T, n, k, salida); };
+        break;
+      }
+      medianas[c] = medir(restaurar, ejecutar, op.config, reloj).mediana;
+    }
+    f << k;
+    for (int c = 0; c < NUM_FORMAS_PARCIAL; c++)
+      f << "\t" << medianas[c];
+    f << "\t" << completa / std::min(medianas[PARCIAL_ORDENACION],
+                                      medianas[PARCIAL_MONTON]) << endl;
+    if (k == n)
+      break;
+  }
+  cout << endl;
+
+  delete [] original;
+  delete [] T;
+  delete [] salida;
+  return 0;
+}
+
+
+/**
+   @brief Lotes seguidos que se insertan en cada medición de incremental.dat.
+**/
+const Indice LOTES_INCREMENTAL = 1000;
+
+
+/**
+   @brief Compara la inserción de lotes en VectorOrdenado y en
+   NivelesOrdenados (incremental.h) con volver a ordenar todo.
+
+   Para bases de n / 100, n / 10 y n elementos ya ordenados y lotes de
+   m = 10, 100, ... elementos (hasta la décima parte de la base) escribe
+   en incremental.dat una fila con la mediana de ordenar de nuevo con
+   quicksort_robusto la base y un lote y la media por lote de insertar
+   min(base / m, LOTES_INCREMENTAL) lotes seguidos en cada contenedor,
+   de modo que las mezclas de NivelesOrdenados quedan amortizadas. La
+   última columna es la aceleración del mejor contenedor.
+*/
+static int incremental(const Opciones & op, const Reloj & reloj)
+{
+  Indice n = op.tamanio_incremental;
+  if (!cabe(2 * bytes_medicion<float>(n), n))
+    return -1;
+  string fichero = op.salida + "/incremental.dat";
+  std::ofstream f(fichero.c_str());
+  if (!f) {
+    cerr << "No se puede escribir " << fichero << endl;
+    return -1;
+  }
+
+  // La base y los lotes salen de semillas distintas
+  vector<float> ordenado(n), nuevos(n), T(n + n / 10);
+  Generador generador(op.distribucion, op.semilla);
+  generador.rellenar(ordenado.data(), n);
+  Generador generador_lotes(op.distribucion, op.semilla + 1);
+  generador_lotes.rellenar(nuevos.data(), n);
+
+  cout << "Inserción incremental con hasta " << n << " elementos:" << endl;
+  f << "# distribucion " << generador.descripcion() << ", semilla "
+    << op.semilla << endl;
+  f << "# base\tlote\treordenar\tvector_ordenado\tniveles\taceleracion"
+    << " (segundos por lote)" << endl;
+
+  const Indice bases[] = { n / 100, n / 10, n };
+  for (int b = 0; b < 3; b++) {
+    Indice base = bases[b];
+    if (base < 100 || (b > 0 && base == bases[b - 1]))
+      continue;
+    quicksort_robusto(ordenado.data(), base);
+    VectorOrdenado<float> vector_inicial;
+    vector_inicial.asignar(ordenado.data(), base);
+    NivelesOrdenados<float> niveles_inicial;
+    niveles_inicial.asignar(ordenado.data(), base);
+
+    for (Indice m = 10; m <= base / 10; m *= 10) {
+      cout << "\tbase " << base << ", lote " << m << endl;
+      Indice lotes = std::min(base / m, LOTES_INCREMENTAL);
+      VectorOrdenado<float> v;
+      NivelesOrdenados<float> l;
+
+      double reordenar = medir(
+        [&]() {
+          std::copy(ordenado.begin(), ordenado.begin() + base, T.begin());
+          std::copy(nuevos.begin(), nuevos.begin() + m, T.begin() + base);
+        },
+        [&]() { quicksort_robusto(T.data(), base + m); },
+        op.config, reloj).mediana;
+      double por_vector = medir(
+        [&]() { v = vector_inicial; v.reservar(base + lotes * m); },
+        [&]() {
+          for (Indice i = 0; i < lotes; i++)
+            v.insertar(nuevos.data() + i * m, m);
+        },
+        op.config, reloj).mediana / lotes;
+      double por_niveles = medir(
+        [&]() { l = niveles_inicial; },
+        [&]() {
+          for (Indice i = 0; i < lotes; i++)
+            l.insertar(nuevos.data() + i * m, m);
+        },
+        op.config, reloj).mediana / lotes;
+
+      f << base << "\t" << m << "\t" << reordenar << "\t" << por_vector
+        << "\t" << por_niveles << "\t"
+        << reordenar / std::min(por_vector, por_niveles) << endl;
+    }
+  }
+  cout << endl;
+
+  return 0;
+}
+
+
+/**
+   @brief Umbrales que se prueban al calibrar los algoritmos híbridos.
+*/
+static const int CORTES_CALIBRACION[] = {
+  4, 8, 12, 16, 24, 32, 48, 64, 96, 128, 192, 256
+};
+
+static const int NUM_CORTES =
+  sizeof(CORTES_CALIBRACION) / sizeof(CORTES_CALIBRACION[0]);
+
+
+/**
+   @brief Calibra los umbrales de los algoritmos híbridos para Tipo.
+
+   Mide con op.tamanio_calibracion elementos cada híbrido elegido con
+   -a (o, si no hay ninguno, todos) y cada umbral de CORTES_CALIBRACION,
+   y deja en Umbrales<Tipo> el de menor mediana. Escribe
+   calibracion<sufijo>.dat con una fila por umbral y la mediana de cada
+   algoritmo.
+*/
+template <class Tipo>
+static int calibrar(const Opciones & op, const string & sufijo,
+                    const Reloj & reloj)
+{
+  const vector<Algoritmo<Tipo> > & algs = algoritmos<Tipo>();
+  Indice n = op.tamanio_calibracion;
+
+  // quicksort_vectorial sólo tiene umbral propio con float
+  vector<Hibrido> hibridos;
+  vector<int> columnas;
+  for (int pasada = 0; pasada < 2 && columnas.empty(); pasada++)
+    for (int h = 0; h < NUM_HIBRIDOS; h++) {
+      if (h == HIBRIDO_QUICKSORT_VECTORIAL && !std::is_same<Tipo, float>::value)
+        continue;
+      int a = buscar_algoritmo(nombre_hibrido(Hibrido(h)));
+      if (pasada == 1 || op.seleccion[a]) {
+        hibridos.push_back(Hibrido(h));
+        columnas.push_back(a);
+      }
+    }
+
+  string fichero = op.salida + "/calibracion" + sufijo + ".dat";
+  std::ofstream f(fichero.c_str());
+  if (!f) {
+    cerr << "No se puede escribir " << fichero << endl;
+    return -1;
+  }
+
+  if (!cabe(bytes_medicion<Tipo>(n), n))
+    return -1;
+  Tipo * T = static_cast<Tipo *>(aligned_alloc(ALINEACION,
+      ((size_t) n * sizeof(Tipo) + ALINEACION - 1) / ALINEACION * ALINEACION));
+  if (T == NULL) {
+    cerr << "No hay memoria para " << n << " elementos" << endl;
+    return -1;
+  }
+
+  Generador generador(op.distribucion, op.semilla);
+  cout << "Calibrando los umbrales (calibracion" << sufijo << ".dat) con "
+       << n << " elementos:" << endl;
+  f << "# distribucion " << generador.descripcion() << ", semilla "
+    << op.semilla << endl;
+  f << "# umbral";
+  for (size_t c = 0; c < columnas.size(); c++)
+    f << "\t" << algs[columnas[c]].nombre;
+  f << " (n = " << n << ", segundos)" << endl;
+
+  vector<vector<double> > medianas(columnas.size(), vector<double>(NUM_CORTES));
+  for (size_t c = 0; c < columnas.size(); c++) {
+    int & umbral = Umbrales<Tipo>::valor[hibridos[c]];
+    int mejor = 0;
+    for (int u = 0; u < NUM_CORTES; u++) {
+      umbral = CORTES_CALIBRACION[u];
+      Estadisticos e = medir_algoritmo(algs[columnas[c]], T, n, generador,
+                                       op.semilla, op.config, reloj, NULL,
+                                       NULL);
+      medianas[c][u] = e.mediana;
+      if (e.mediana < medianas[c][mejor])
+        mejor = u;
+    }
+    umbral = CORTES_CALIBRACION[mejor];
+    cout << "\t" << algs[columnas[c]].nombre << ": " << umbral << endl;
+  }
+  cout << endl;
+
+  for (int u = 0; u < NUM_CORTES; u++) {
+    f << CORTES_CALIBRACION[u];
+    for (size_t c = 0; c < columnas.size(); c++)
+      f << "\t" << medianas[c][u];
+    f << endl;
+  }
+
+  free(T);
+  return 0;
+}
+
+
+/**
+   @brief Escribe op.generar elementos de la distribución en un fichero.
+
+   Los genera por bloques de la mitad de --memoria, así que el fichero
+   puede ser mayor que la memoria. Con cabecera escribe un fichero de
+   datos (datos.h); si no, sólo los elementos.
+*/
+template <class Tipo>
+static int generar(const Opciones & op, const string & nombre, bool cabecera)
+{
+  cout << "Generando " << op.generar << " elementos en " << nombre << endl;
+  Generador generador(op.distribucion, op.semilla);
+  FILE * f = abrir_sin_bufer(nombre, "wb");
+  long long bloque = op.memoria_externo / 2 / sizeof(Tipo);
+  vector<Tipo> T(std::min(bloque, op.generar));
+  bool bien = f != NULL;
+  if (bien && cabecera)
+    bien = escribir_cabecera_datos(f, DatoDe<Tipo>::tipo, sizeof(Tipo),
+                                   op.generar);
+  for (long long i = 0; i < op.generar && bien; i += T.size()) {
+    Indice n = std::min((long long) T.size(), op.generar - i);
+    generador.rellenar(&T[0], n);
+    bien = escribir_bloque(f, &T[0], n * sizeof(Tipo));
+  }
+  if (f == NULL || fclose(f) != 0 || !bien) {
+    cerr << "No se puede escribir " << nombre << endl;
+    return -1;
+  }
+  return 0;
+}
+
+
+/**
+   @brief Ordena externamente el fichero op.externo con elementos de Tipo.
+
+   Si op.generar > 0, primero escribe en él tantos elementos de la
+   distribución elegida. El resultado se escribe en
+   <salida>/<fichero>.ordenado, con los tramos intermedios en el
+   directorio de salida, y el informe en externo<sufijo>.dat.
+*/
+template <class Tipo>
+static int externo(const Opciones & op, const string & sufijo)
+{
+  const Algoritmo<Tipo> & alg = algoritmos<Tipo>()[op.algoritmo_fichero];
+
+  if (op.generar > 0 && generar<Tipo>(op, op.externo, false) != 0)
+    return -1;
+
+  string base = op.externo.substr(op.externo.find_last_of('/') + 1);
+  string destino = op.salida + "/" + base + ".ordenado";
+  cout << "Ordenando " << op.externo << " en " << destino << " con "
+       << alg.nombre << " y " << (op.memoria_externo >> 20)
+       << " MiB de memoria" << endl;
+
+  InformeExterno informe;
+  string error;
+  if (!ordenar_externo<Tipo>(op.externo, destino, op.salida,
+                             op.memoria_externo, alg.ordenar, informe,
+                             error)) {
+    cerr << "Ordenación externa: " << error << endl;
+    return -1;
+  }
+
+  string fichero = op.salida + "/externo" + sufijo + ".dat";
+  std::ofstream f(fichero.c_str());
+  if (!f) {
+    cerr << "No se puede escribir " << fichero << endl;
+    return -1;
+  }
+  f << "# " << informe.elementos << " elementos, " << informe.tramos
+    << " tramos, " << informe.pasadas << " pasadas de mezcla de hasta "
+    << informe.aridad << " tramos, " << (op.memoria_externo >> 20)
+    << " MiB, " << alg.nombre << endl;
+  f << "# fase\tsegundos\tMiB_leidos\tMiB_escritos\tMiB/s" << endl;
+  const FaseExterna * fases[] = { &informe.formacion, &informe.mezcla };
+  const char * nombres[] = { "tramos", "mezcla" };
+  for (int i = 0; i < 2; i++) {
+    f << nombres[i] << "\t" << fases[i]->segundos
+      << "\t" << fases[i]->leidos / 1048576.0
+      << "\t" << fases[i]->escritos / 1048576.0
+      << "\t" << fases[i]->caudal() / 1048576.0 << endl;
+    cout << "\t" << nombres[i] << ": " << fases[i]->segundos << " s, "
+         << (fases[i]->leidos + fases[i]->escritos) / 1048576.0 << " MiB, "
+         << fases[i]->caudal() / 1048576.0 << " MiB/s" << endl;
+  }
+  cout << endl;
+  return 0;
+}
+
+
+/**
+   @brief Tiempo y fallos de página de una fase de la ordenación de datos.
+*/
+struct FaseDatos {
+  const char * nombre;
+  double segundos;
+  long fallos_menores;
+  long fallos_mayores;    ///< Fallos que han necesitado leer del disco.
+};
+
+
+/**
+   @brief Ordena el fichero de datos proyectado en f, de elementos Tipo.
+
+   Separa en fases la carga de las páginas de la proyección (fallos de
+   página y lectura del disco), la ordenación y la escritura del
+   resultado: en <salida>/<fichero>.ordenado o, con --en-sitio, el
+   propio fichero. Escribe el tiempo y los fallos de página de cada una
+   en datos<sufijo>.dat.
+*/
+template <class Tipo>
+static int ordenar_datos(const Opciones & op, const string & sufijo,
+                         FicheroDatos & f, const Reloj & reloj)
+{
+  const Algoritmo<Tipo> & alg = algoritmos<Tipo>()[op.algoritmo_fichero];
+  Tipo * T = static_cast<Tipo *>(f.datos());
+  Indice n = f.num_elem();
+  string base = op.datos.substr(op.datos.find_last_of('/') + 1);
+  string destino = op.en_sitio ? op.datos : op.salida + "/" + base + ".ordenado";
+
+  FaseDatos fases[] = {
+    { "carga", 0, 0, 0 }, { "ordenacion", 0, 0, 0 }, { "escritura", 0, 0, 0 }
+  };
+  bool bien = true;
+  for (int i = 0; i < 3 && bien; i++) {
+    struct rusage antes, despues;
+    getrusage(RUSAGE_SELF, &antes);
+    uint64_t t0 = reloj.ahora();
+    if (i == 0) {
+      f.cargar();
+    } else if (i == 1) {
+      alg.ordenar(T, n);
+    } else if (op.en_sitio) {
+      bien = f.sincronizar();
+    } else {
+      string error;
+      bien = escribir_datos(destino, DatoDe<Tipo>::tipo, sizeof(Tipo), T, n,
+                            error);
+    }
+    fases[i].segundos = reloj.segundos(reloj.ahora() - t0);
+    getrusage(RUSAGE_SELF, &despues);
+    fases[i].fallos_menores = despues.ru_minflt - antes.ru_minflt;
+    fases[i].fallos_mayores = despues.ru_majflt - antes.ru_majflt;
+  }
+  if (!bien) {
+    cerr << "No se puede escribir " << destino << endl;
+    return -1;
+  }
+
+  string fichero = op.salida + "/datos" + sufijo + ".dat";
+  std::ofstream d(fichero.c_str());
+  if (!d) {
+    cerr << "No se puede escribir " << fichero << endl;
+    return -1;
+  }
+  cout << "Ordenados " << n << " elementos de " << op.datos << " en "
+       << destino << " con " << alg.nombre << endl;
+  d << "# " << op.datos << ": " << n << " elementos "
+    << nombre_tipo_dato(f.tipo()) << ", " << alg.nombre
+    << (op.en_sitio ? ", en sitio" : ", copia privada") << endl;
+  d << "# fase\tsegundos\tfallos_menores\tfallos_mayores (reloj "
+    << reloj.nombre() << ")" << endl;
+  for (int i = 0; i < 3; i++) {
+    d << fases[i].nombre << "\t" << fases[i].segundos << "\t"
+      << fases[i].fallos_menores << "\t" << fases[i].fallos_mayores << endl;
+    cout << "\t" << fases[i].nombre << ": " << fases[i].segundos << " s, "
+         << fases[i].fallos_menores << " fallos de página menores y "
+         << fases[i].fallos_mayores << " mayores" << endl;
+  }
+  cout << endl;
+  return 0;
+}
+
+
+/* ************************************************************ */
+/*  Verificación  */
+
+/**
+   Tamaños de --verificar: los vacíos y mínimos, los que rodean a
+   potencias de dos y a los umbrales por defecto de los híbridos, y uno
+   con varios niveles de división en todos los algoritmos. Se añaden los
+   que rodean a los umbrales cargados de cada tipo.
+**/
+static const Indice TAMANIOS_VERIFICACION[] = {
+  0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 49, 50, 51, 63, 64, 65,
+  99, 100, 101, 127, 128, 129, 1000, 4097
+};
+
+/**
+   Tamaño con el que se verifican además los algoritmos paralelos, por
+   encima de los cortes de quicksort_paralelo y mergesort_paralelo para
+   que repartan el trabajo entre los hilos.
+**/
+static const Indice TAMANIO_VERIFICACION_PARALELO = (1 << 17) + 1;
+
+
+/**
+   @brief Orden por bytes, para comparar conjuntos de elementos que
+   operator< considera equivalentes (registros con la misma clave).
+*/
+template <class Tipo>
+static bool menor_bytes(const Tipo & a, const Tipo & b)
+{
+  return memcmp(&a, &b, sizeof(Tipo)) < 0;
+}
+
+
+/**
+   @brief Comprueba que los m elementos de S están, byte a byte, entre
+   los num_elem de E, contando las repeticiones.
+*/
+template <class Tipo>
+static bool contenidos(const Tipo S[], Indice m, const Tipo E[],
+                       Indice num_elem)
+{
+  vector<Tipo> a(S, S + m), b(E, E + num_elem);
+  std::sort(a.begin(), a.end(), menor_bytes<Tipo>);
+  std::sort(b.begin(), b.end(), menor_bytes<Tipo>);
+  return std::includes(b.begin(), b.end(), a.begin(), a.end(),
+                       menor_bytes<Tipo>);
+}
+
+
+/**
+   @brief Comprueba que R y E tienen en cada una de las m primeras
+   posiciones elementos equivalentes según operator<.
+*/
+template <class Tipo>
+static bool equivalentes(const Tipo R[], const Tipo E[], Indice m)
+{
+  for (Indice i = 0; i < m; i++)
+    if (R[i] < E[i] || E[i] < R[i])
+      return false;
+  return true;
+}
+
+
+/**
+   @brief Comprueba una ordenación frente a la de std::sort.
+
+   @param R: resultado del algoritmo, con num_elem elementos.
+   @param E: la misma entrada ordenada con std::sort.
+   @param num_elem: número de elementos.
+   @return true si R tiene en cada posición un elemento equivalente al
+           de E y los mismos elementos, byte a byte, que la entrada.
+*/
+template <class Tipo>
+static bool coincide(const Tipo R[], const Tipo E[], Indice num_elem)
+{
+  return equivalentes(R, E, num_elem) && contenidos(R, num_elem, E, num_elem);
+}
+
+
+/**
+   @brief Compara las funciones de parcial.h con std::sort.
+
+   @param entrada: vector de entrada.
+   @param esperado: la entrada ordenada con std::sort.
+   @param caso: tamaño, tipo y distribución de la entrada, para los
+                mensajes.
+   @return número de comprobaciones fallidas, que se indican en cerr.
+
+   Con n elementos se prueba cada k de 0, 1, n - 1, n y n + 1 que admita
+   cada función: quickselect necesita 0 <= k < n y MenoresK, k > 0.
+*/
+template <class Tipo>
+static int verificar_seleccion(const vector<Tipo> & entrada,
+                               const vector<Tipo> & esperado,
+                               const string & caso)
+{
+  const Indice n = entrada.size();
+  const Indice K[] = { 0, 1, n - 1, n, n + 1 };
+  const Tipo * E = esperado.data();
+  int fallos = 0;
+  for (size_t j = 0; j < sizeof(K) / sizeof(K[0]); j++) {
+    const Indice k = K[j];
+    if (k < 0 || (j > 0 && k <= K[j - 1]))
+      continue;
+    auto error = [&](const char * funcion) {
+      cerr << "Error: " << funcion << " falla con k = " << k << " y " << caso
+           << endl;
+      fallos++;
+    };
+    const Indice m = std::min(k, n);
+    vector<Tipo> T;
+
+    if (k < n) {
+      T = entrada;
+      quickselect(T.data(), n, k);
+      bool bien = equivalentes(&T[k], &E[k], 1) &&
+                  contenidos(T.data(), n, E, n);
+      for (Indice i = 0; i < n && bien; i++)
+        bien = i < k ? !(T[k] < T[i]) : !(T[i] < T[k]);
+      if (!bien)
+        error("quickselect");
+    }
+
+    T = entrada;
+    ordenacion_parcial(T.data(), n, k);
+    if (!equivalentes(T.data(), E, m) || !contenidos(T.data(), n, E, n))
+      error("ordenacion_parcial");
+
+    T.assign(m, Tipo());
+    menores_k(entrada.data(), n, k, T.data());
+    if (!equivalentes(T.data(), E, m) || !contenidos(T.data(), m, E, n))
+      error("menores_k");
+
+    if (k > 0) {
+      // La mitad de la entrada de golpe y el resto de uno en uno
+      MenoresK<Tipo> menores(k);
+      menores.insertar(entrada.data(), n / 2);
+      for (Indice i = n / 2; i < n; i++)
+        menores.insertar(entrada[i]);
+      T.assign(menores.num_elem(), Tipo());
+      menores.ordenados(T.data());
+      if (menores.num_elem() != m || !equivalentes(T.data(), E, m) ||
+          !contenidos(T.data(), m, E, n) ||
+          (m == k && !equivalentes(&menores.maximo(), &E[k - 1], 1)))
+        error("MenoresK");
+    }
+  }
+  return fallos;
+}
+
+
+/**
+   @brief Compara los contenedores de incremental.h con std::sort.
+
+   @param entrada: vector de entrada.
+   @param esperado: la entrada ordenada con std::sort.
+   @param caso: tamaño, tipo y distribución de la entrada, para los
+                mensajes.
+   @return número de comprobaciones fallidas, que se indican en cerr.
+
+   Los dos contenedores empiezan con la primera cuarta parte de la
+   entrada y reciben el resto en lotes de 0, 1, 2, 4, ... elementos.
+   Después se comprueban los elementos de VectorOrdenado, los niveles de
+   NivelesOrdenados y sus consultas, y el nivel que deja compactar.
+*/
+template <class Tipo>
+static int verificar_incremental(const vector<Tipo> & entrada,
+                                 const vector<Tipo> & esperado,
+                                 const string & caso)
+{
+  const Indice n = entrada.size();
+  const Tipo * E = esperado.data();
+  VectorOrdenado<Tipo> ordenado;
+  NivelesOrdenados<Tipo> niveles;
+  Indice i = n / 4;
+  ordenado.asignar(entrada.data(), i);
+  niveles.asignar(entrada.data(), i);
+  for (Indice m = 0; i < n; m = std::max<Indice>(2 * m, 1)) {
+    Indice lote = std::min(m, n - i);
+    ordenado.insertar(&entrada[i], lote);
+    niveles.insertar(&entrada[i], lote);
+    i += lote;
+  }
+
+  int fallos = 0;
+  if (ordenado.num_elem() != n || !coincide(ordenado.elementos(), E, n)) {
+    cerr << "Error: VectorOrdenado falla con " << caso << endl;
+    fallos++;
+  }
+
+  // Cada nivel ordenado y con FACTOR_NIVELES veces los del siguiente
+  bool bien = niveles.num_elem() == n;
+  vector<Tipo> todos;
+  for (int l = 0; l < niveles.num_niveles() && bien; l++) {
+    const vector<Tipo> & v = niveles.nivel(l);
+    bien = std::is_sorted(v.begin(), v.end()) &&
+           (l == 0 || niveles.nivel(l - 1).size() >= FACTOR_NIVELES * v.size());
+    todos.insert(todos.end(), v.begin(), v.end());
+  }
+  bien = bien && (Indice) todos.size() == n &&
+         contenidos(todos.data(), n, E, n);
+  for (i = 0; i < n && bien; i += 1 + n / 16)
+    bien = niveles.contiene(E[i]) &&
+           niveles.contar_menores(E[i]) == std::lower_bound(E, E + n, E[i]) - E;
+  niveles.compactar();
+  bien = bien && niveles.num_niveles() <= 1 && niveles.num_elem() == n &&
+         (n == 0 || coincide(niveles.nivel(0).data(), E, n));
+  if (!bien) {
+    cerr << "Error: NivelesOrdenados falla con " << caso << endl;
+    fallos++;
+  }
+  return fallos;
+}
+
+
+/**
+   @brief Compara la ordenación por índices de indices.h con std::stable_sort.
+
+   Sólo comprueba registros: los demás tipos no tienen una clave aparte
+   del elemento.
+*/
+template <class Tipo>
+static int verificar_indices(const vector<Tipo> &, const string &)
+{
+  return 0;
+}
+
+
+/**
+   @param entrada: registros de entrada, con la posición de cada uno
+                   en la carga, de modo que el orden estable es único.
+   @param caso: tamaño, tipo y distribución de la entrada, para los
+                mensajes.
+   @return número de comprobaciones fallidas, que se indican en cerr.
+
+   argsort debe dar una permutación con las claves en orden creciente y
+   las posiciones de las claves iguales también en orden (estable), y
+   reunir con ella y ordenar_por_clave con radix y con quicksort_robusto
+   deben dejar, byte a byte, el resultado de std::stable_sort.
+*/
+static int verificar_indices(const vector<Registro> & entrada,
+                             const string & caso)
+{
+  const Indice n = entrada.size();
+  if (n == 0)
+    return 0;
+  vector<Registro> esperado = entrada;
+  std::stable_sort(esperado.begin(), esperado.end());
+  auto clave = [](const Registro & r) { return r.clave; };
+  auto quicksort_pares = [](ClaveIndice P[], Indice m) { quicksort_robusto(P, m); };
+  auto iguales = [&](const vector<Registro> & T) {
+    return memcmp(T.data(), esperado.data(), n * sizeof(Registro)) == 0;
+  };
+  int fallos = 0;
+  auto error = [&](const char * funcion) {
+    cerr << "Error: " << funcion << " falla con " << caso << endl;
+    fallos++;
+  };
+
+  vector<uint32_t> perm(n);
+  argsort(entrada.data(), n, perm.data(), clave);
+  vector<bool> visto(n, false);
+  bool bien = true;
+  for (Indice i = 0; i < n && bien; i++) {
+    bien = perm[i] < n && !visto[perm[i]];
+    if (bien)
+      visto[perm[i]] = true;
+    if (bien && i > 0) {
+      const Registro & a = entrada[perm[i - 1]], & b = entrada[perm[i]];
+      bien = !(b < a) && (a < b || perm[i - 1] < perm[i]);
+    }
+  }
+  if (!bien)
+    error("argsort");
+
+  vector<Registro> T(n);
+  reunir(entrada.data(), T.data(), perm.data(), n);
+  if (bien && !iguales(T))
+    error("reunir");
+
+  T = entrada;
+  ordenar_por_clave(T.data(), n, clave, RadixPares());
+  if (!iguales(T))
+    error("ordenar_por_clave con radix");
+
+  vector<Registro> aux(n);
+  T = entrada;
+  ordenar_por_clave(T.data(), n, clave, quicksort_pares, aux.data());
+  if (!iguales(T))
+    error("ordenar_por_clave con quicksort_robusto");
+  return fallos;
+}
+
+
+/**
+   @brief Tamaños de --verificar para el tipo Tipo, sin repetidos.
+*/
+template <class Tipo>
+static vector<Indice> tamanios_verificacion()
+{
+  vector<Indice> tamanios(TAMANIOS_VERIFICACION, TAMANIOS_VERIFICACION +
+                          sizeof(TAMANIOS_VERIFICACION) / sizeof(Indice));
+  for (int h = 0; h < NUM_HIBRIDOS; h++)
+    for (int d = -1; d <= 1; d++)
+      tamanios.push_back(umbral<Tipo>(Hibrido(h)) + d);
+  std::sort(tamanios.begin(), tamanios.end());
+  tamanios.erase(std::unique(tamanios.begin(), tamanios.end()),
+                 tamanios.end());
+  return tamanios;
+}
+
+
+/**
+   @brief Compara los algoritmos elegidos con std::sort.
+
+   @param op: opciones; se usan la selección de algoritmos y la semilla.
+   @param distribuciones: distribuciones de las entradas.
+   @param nombre: nombre del tipo de elemento, para los mensajes.
+   @return número de comprobaciones fallidas, que se indican en cerr.
+
+   Cada algoritmo ordena, con cada distribución, una entrada de cada
+   tamaño de tamanios_verificacion, generada con la misma semilla que
+   usaría el barrido para ese tamaño, y los paralelos además una de
+   TAMANIO_VERIFICACION_PARALELO elementos. Con cada entrada se
+   comprueban también las funciones de parcial.h y los contenedores de
+   incremental.h, y con las de registros la ordenación por índices de
+   indices.h.
+*/
+template <class Tipo>
+static int verificar(const Opciones & op,
+                     const vector<Distribucion> & distribuciones,
+                     const char * nombre)
+{
+  const vector<Algoritmo<Tipo> > & algs = algoritmos<Tipo>();
+  vector<Indice> tamanios = tamanios_verificacion<Tipo>();
+  int fallos = 0;
+  for (size_t d = 0; d < distribuciones.size(); d++) {
+    Generador generador(distribuciones[d], op.semilla);
+    cout << "\t" << nombre << ", " << generador.descripcion() << endl;
+    for (size_t i = 0; i <= tamanios.size(); i++) {
+      Indice n = i < tamanios.size() ? tamanios[i]
+                                     : TAMANIO_VERIFICACION_PARALELO;
+      vector<Tipo> entrada(n), esperado, T;
+      generador.reiniciar(op.semilla ^ ((uint64_t) n * 0x9E3779B97F4A7C15ULL));
+      if (n > 0)
+        generador.rellenar(entrada.data(), n);
+      esperado = entrada;
+      std::sort(esperado.begin(), esperado.end());
+      std::ostringstream caso;
+      caso << n << " elementos " << nombre << " " << generador.descripcion();
+      for (int a = 0; a < NUM_ALGORITMOS; a++) {
+        if (!op.seleccion[a] || (i == tamanios.size() && !algs[a].paralelo))
+          continue;
+        T = entrada;
+        algs[a].ordenar(T.data(), n);
+        if (!coincide(T.data(), esperado.data(), n)) {
+          cerr << "Error: " << algs[a].nombre << " no ordena " << caso.str()
+               << endl;
+          fallos++;
+        }
+      }
+      fallos += verificar_seleccion(entrada, esperado, caso.str());
+      fallos += verificar_incremental(entrada, esperado, caso.str());
+      fallos += verificar_indices(entrada, caso.str());
+    }
+  }
+  return fallos;
+}
+
+
+/* ************************************************************ */
+/*  Tipos de elemento  */
+
+struct TipoElemento {
+  const char * nombre;
+  int (*barrido)(const Opciones & op, const string & sufijo,
+                 const Reloj & reloj, ContadoresHW * contadores);
+  int (*calibrar)(const Opciones & op, const string & sufijo,
+                  const Reloj & reloj);
+  int (*externo)(const Opciones & op, const string & sufijo);
+  int (*generar)(const Opciones & op, const string & nombre, bool cabecera);
+  int (*datos)(const Opciones & op, const string & sufijo, FicheroDatos & f,
+               const Reloj & reloj);
+  int (*verificar)(const Opciones & op,
+                   const vector<Distribucion> & distribuciones,
+                   const char * nombre);
+};
+
+/**
+   En el orden de TipoDato, para elegir el de un fichero de datos.
+**/
+static const TipoElemento TIPOS[] = {
+  { "float",    barrido<float>,    calibrar<float>,    externo<float>,
+    generar<float>,    ordenar_datos<float>,    verificar<float> },
+  { "double",   barrido<double>,   calibrar<double>,   externo<double>,
+    generar<double>,   ordenar_datos<double>,   verificar<double> },
+  { "uint32",   barrido<uint32_t>, calibrar<uint32_t>, externo<uint32_t>,
+    generar<uint32_t>, ordenar_datos<uint32_t>, verificar<uint32_t> },
+  { "uint64",   barrido<uint64_t>, calibrar<uint64_t>, externo<uint64_t>,
+    generar<uint64_t>, ordenar_datos<uint64_t>, verificar<uint64_t> },
+  { "registro", barrido<Registro>, calibrar<Registro>, externo<Registro>,
+    generar<Registro>, ordenar_datos<Registro>, verificar<Registro> },
+};
+
+static const int NUM_TIPOS = sizeof(TIPOS) / sizeof(TIPOS[0]);
+
+
+/**
+   @brief Interpreta una lista de tipos de elemento separados por comas.
+   @param lista: cadena con los nombres.
+   @param tipos: tipos elegidos. Es MODIFICADO.
+   @return false si algún nombre no corresponde a un tipo o no se elige
+           ninguno.
+*/
+static bool leer_tipos(const string & lista, vector<bool> & tipos)
+{
+  std::stringstream ss(lista);
+  string nombre;
+  bool alguno = false;
+  tipos.assign(NUM_TIPOS, false);
+  while (getline(ss, nombre, ',')) {
+    int i = 0;
+    while (i < NUM_TIPOS && nombre != TIPOS[i].nombre)
+      i++;
+    if (i == NUM_TIPOS) {
+      cerr << "Tipo desconocido: " << nombre << endl;
+      return false;
+    }
+    tipos[i] = true;
+    alguno = true;
+  }
+  if (!alguno)
+    cerr << "No se ha elegido ningún tipo de elemento" << endl;
+  return alguno;
+}
+
+
+/**
+   @brief Interpreta una lista de distribuciones separadas por comas.
+   @param lista: cadena con las distribuciones (nombre[:parametro]).
+   @param distribuciones: distribuciones elegidas. Es MODIFICADO.
+   @return false si alguna no es válida.
+*/
+static bool leer_distribuciones(const string & lista,
+                                vector<Distribucion> & distribuciones)
+{
+  std::stringstream ss(lista);
+  string texto;
+  distribuciones.clear();
+  while (getline(ss, texto, ',')) {
+    Distribucion d;
+    if (!Generador::leer(texto, d)) {
+      cerr << "Distribución desconocida: " << texto << endl;
+      return false;
+    }
+    distribuciones.push_back(d);
+  }
+  return !distribuciones.empty();
+}
+
+
+static void uso(const char * programa)
+{
+  cerr << "Formato " << programa << " [opciones] <directorio_salida>" << endl
+       << "  -a alg1,alg2,...  algoritmos a medir (por defecto todos):" << endl
+       << "                    ";
+  for (int i = 0; i < NUM_ALGORITMOS; i++)
+    cerr << algoritmos<float>()[i].nombre << " ";
+  cerr << endl
+       << "                    (los no incluidos por defecto son: ";
+  for (int i = 0; i < NUM_ALGORITMOS; i++)
+    if (!algoritmos<float>()[i].por_defecto)
+      cerr << algoritmos<float>()[i].nombre << " ";
+  cerr << ")" << endl
+       << "  -t tipo1,tipo2,.. tipos de elemento (por defecto float):" << endl
+       << "                    ";
+  for (int i = 0; i < NUM_TIPOS; i++)
+    cerr << TIPOS[i].nombre << " ";
+  cerr << endl
+       << "  -d dist1,dist2,.. distribuciones de entrada, cada una con un" << endl
+       << "                    parámetro opcional (dist:param; por defecto" << endl
+       << "                    uniforme):" << endl
+       << "                    ";
+  for (int i = 0; i < NUM_DISTRIBUCIONES; i++)
+    cerr << Generador::nombre(TipoDistribucion(i)) << " ";
+  cerr << endl
+       << "  -s semilla        semilla de las entradas (1)" << endl
+       << "  -p hilos          hilos de los algoritmos paralelos (por" << endl
+       << "                    defecto, los del sistema)" << endl
+       << "  -j puntos         puntos (algoritmo, tamaño) medidos a la vez," << endl
+       << "                    cada uno en un núcleo físico distinto (1)" << endl
+       << "  --sin-afinidad    no fija los hilos medidores a un núcleo" << endl
+       << "  --escalado n      mide los algoritmos paralelos con n" << endl
+       << "                    elementos y de 1 a p hilos (escalado.dat)" << endl
+       << "  --paginas p       reserva los vectores y los auxiliares en una" << endl
+       << "                    arena por hilo prefallada con páginas de 4k," << endl
+       << "                    2m (transparentes) o hugetlb (reservadas)" << endl
+       << "  --registros n     compara con n registros de 8 a 256 bytes" << endl
+       << "                    la ordenación directa con la ordenación" << endl
+       << "                    por índices (registros.dat)" << endl
+       << "  --parcial n       mide los k menores de n elementos con" << endl
+       << "                    selección y ordenación parcial, de k = 1" << endl
+       << "                    a n, frente a ordenarlos todos (parcial.dat)" << endl
+       << "  --incremental n   inserta lotes en vectores ordenados de hasta" << endl
+       << "                    n elementos por mezcla y por niveles, frente" << endl
+       << "                    a ordenarlos de nuevo (incremental.dat)" << endl
+       << "  --verificar       en lugar del barrido, compara los algoritmos" << endl
+       << "                    de -a con std::sort con los tipos de -t, las" << endl
+       << "                    distribuciones de -d (por defecto, todos) y" << endl
+       << "                    tamaños de 0 a 4097; no necesita directorio" << endl
+       << "  -r ini:fin:salto  rango de tamaños para todos los algoritmos" << endl
+       << "                    (por defecto 5000:125000:5000 para los" << endl
+       << "                    cuadráticos y 50000:1250000:50000 para nlogn)" << endl
+       << "  -m muestras       muestras mínimas por tamaño (10)" << endl
+       << "  --max-muestras n  límite del remuestreo adaptativo (50)" << endl
+       << "  --calentamiento n ejecuciones previas sin medir (1)" << endl
+       << "  --precision p     semiamplitud relativa del intervalo de" << endl
+       << "                    confianza de la mediana buscada (0.02)" << endl
+       << "  --tiempo-max s    segundos por punto a partir de los que" << endl
+       << "                    no se remuestrea (10)" << endl
+       << "  --reloj r         steady o tsc (steady)" << endl
+       << "  -c, --contadores  añade los contadores hardware (ciclos," << endl
+       << "                    instrucciones, fallos de L1D, LLC, saltos" << endl
+       << "                    y dTLB) si el sistema los ofrece" << endl
+       << "  -M, --perfil-memoria" << endl
+       << "                    añade las reservas de memoria dinámica, el" << endl
+       << "                    pico de memoria extra y los fallos de página" << endl
+       << "  --particion n     núcleo de quicksort_vectorial: escalar," << endl
+       << "                    avx2 o avx512 (por defecto, el más ancho" << endl
+       << "                    que ofrezca el procesador)" << endl
+       << "  --umbrales f      fichero de umbrales de inserción de los" << endl
+       << "                    híbridos (umbrales.cfg)" << endl
+       << "  --calibrar n      calibra los umbrales con n elementos y" << endl
+       << "                    los guarda en el fichero de --umbrales" << endl
+       << "  --externo f       en lugar del barrido, ordena el fichero f" << endl
+       << "                    (elementos del primer tipo de -t) con el" << endl
+       << "                    primer algoritmo de -a en tramos" << endl
+       << "  --memoria MiB     memoria de la ordenación externa (256)" << endl
+       << "  --datos f         en lugar del barrido, ordena el fichero" << endl
+       << "                    de datos f proyectado en memoria con el" << endl
+       << "                    primer algoritmo de -a" << endl
+       << "  --en-sitio        con --datos, ordena el propio fichero" << endl
+       << "  --generar n       escribe antes n elementos en el fichero" << endl
+       << "                    de --externo o --datos" << endl
+       << "  -h                muestra esta ayuda" << endl;
+}
+
+
+int main(int argc, char * argv[])
+{
+  Opciones op;
+  op.seleccion.resize(NUM_ALGORITMOS);
+  for (int a = 0; a < NUM_ALGORITMOS; a++)
+    op.seleccion[a] = algoritmos<float>()[a].por_defecto;
+  op.rango_fijo = false;
+  op.hilos = std::thread::hardware_concurrency();
+  if (op.hilos < 1)
+    op.hilos = 1;
+  op.puntos = 1;
+  op.afinidad = true;
+  op.memoria = false;
+  op.arena = false;
+  op.paginas = PAGINAS_4K;
+  op.tamanio_escalado = 0;
+  op.tamanio_calibracion = 0;
+  op.tamanio_registros = 0;
+  op.tamanio_parcial = 0;
+  op.tamanio_incremental = 0;
+  op.memoria_externo = (size_t) 256 << 20;
+  op.generar = 0;
+  op.en_sitio = false;
+  op.algoritmo_fichero = buscar_algoritmo("quicksort_robusto");
+  const char * fichero_umbrales = "umbrales.cfg";
+  bool umbrales_explicitos = false;
+  op.semilla = 1;
+  vector<Distribucion> distribuciones(1);
+  distribuciones[0].tipo = UNIFORME;
+  distribuciones[0].parametro = 0;
+  vector<bool> tipos(NUM_TIPOS, false);
+  tipos[0] = true;
+  TipoReloj tipo_reloj = RELOJ_STEADY;
+  bool usar_contadores = false;
+  bool verificar = false;
+  bool algoritmos_explicitos = false, tipos_explicitos = false;
+  bool distribuciones_explicitas = false;
+
+  enum { OPT_MAX_MUESTRAS = 256, OPT_CALENTAMIENTO, OPT_PRECISION,
+         OPT_TIEMPO_MAX, OPT_RELOJ, OPT_ESCALADO, OPT_PARTICION,
+         OPT_UMBRALES, OPT_CALIBRAR, OPT_EXTERNO, OPT_MEMORIA, OPT_GENERAR,
+         OPT_DATOS, OPT_EN_SITIO, OPT_SIN_AFINIDAD,
+         OPT_REGISTROS, OPT_PAGINAS, OPT_PARCIAL,
+         OPT_INCREMENTAL, OPT_VERIFICAR };
+  static const struct option largas[] = {
+    { "max-muestras",  required_argument, 0, OPT_MAX_MUESTRAS },
+    { "calentamiento", required_argument, 0, OPT_CALENTAMIENTO },
+    { "precision",     required_argument, 0, OPT_PRECISION },
+    { "tiempo-max",    required_argument, 0, OPT_TIEMPO_MAX },
+    { "reloj",         required_argument, 0, OPT_RELOJ },
+    { "contadores",    no_argument,       0, 'c' },
+    { "perfil-memoria", no_argument,      0, 'M' },
+    { "escalado",      required_argument, 0, OPT_ESCALADO },
+    { "particion",     required_argument, 0, OPT_PARTICION },
+    { "umbrales",      required_argument, 0, OPT_UMBRALES },
+    { "calibrar",      required_argument, 0, OPT_CALIBRAR },
+    { "externo",       required_argument, 0, OPT_EXTERNO },
+    { "memoria",       required_argument, 0, OPT_MEMORIA },
+    { "generar",       required_argument, 0, OPT_GENERAR },
+    { "datos",         required_argument, 0, OPT_DATOS },
+    { "en-sitio",      no_argument,       0, OPT_EN_SITIO },
+    { "sin-afinidad",  no_argument,       0, OPT_SIN_AFINIDAD },
+    { "registros",     required_argument, 0, OPT_REGISTROS },
+    { "paginas",       required_argument, 0, OPT_PAGINAS },
+    { "parcial",       required_argument, 0, OPT_PARCIAL },
+    { "incremental",   required_argument, 0, OPT_INCREMENTAL },
+    { "verificar",     no_argument,       0, OPT_VERIFICAR },
+    { 0, 0, 0, 0 }
+  };
+
+  int opcion;
+  while ((opcion = getopt_long(argc, argv, "a:t:d:s:r:m:p:j:cMh", largas, NULL)) != -1) {
+    switch (opcion) {
+    case 'a':
+      if (!leer_algoritmos(optarg, op.seleccion))
+        return -1;
+      algoritmos_explicitos = true;
+      {
+        string lista(optarg);
+        op.algoritmo_fichero = buscar_algoritmo(lista.substr(0, lista.find(',')));
+      }
+      break;
+    case 't':
+      if (!leer_tipos(optarg, tipos))
+        return -1;
+      tipos_explicitos = true;
+      break;
+    case 'd':
+      if (!leer_distribuciones(optarg, distribuciones))
+        return -1;
+      distribuciones_explicitas = true;
+      break;
+    case 's': {
+      // strtoull admite un signo menos y da la vuelta
+      char * fin;
+      errno = 0;
+      op.semilla = strtoull(optarg, &fin, 10);
+      if (errno != 0 || fin == optarg || *fin != '\0' ||
+          strchr(optarg, '-') != NULL) {
+        cerr << "La semilla debe ser un entero no negativo" << endl;
+        return -1;
+      }
+      break;
+    }
+    case 'r':
+      if (!leer_rango(optarg, op.rango)) {
+        cerr << "Rango no válido: " << optarg << endl;
+        return -1;
+      }
+      op.rango_fijo = true;
+      break;
+    case 'm':
+      if (!leer_entero(optarg, op.config.muestras_min, 1)) {
+        cerr << "El número de muestras debe ser positivo" << endl;
+        return -1;
+      }
+      break;
+    case 'c':
+      usar_contadores = true;
+      break;
+    case 'M':
+      op.memoria = true;
+      break;
+    case 'p':
+      if (!leer_entero(optarg, op.hilos, 1)) {
+        cerr << "El número de hilos debe ser positivo" << endl;
+        return -1;
+      }
+      break;
+    case 'j':
+      if (!leer_entero(optarg, op.puntos, 1)) {
+        cerr << "El número de puntos a la vez debe ser positivo" << endl;
+        return -1;
+      }
+      break;
+    case OPT_SIN_AFINIDAD:
+      op.afinidad = false;
+      break;
+    case OPT_PAGINAS: {
+      int p = 0;
+      while (p < NUM_TIPOS_PAGINAS && string(optarg) != Arena::nombre(TipoPaginas(p)))
+        p++;
+      if (p == NUM_TIPOS_PAGINAS) {
+        cerr << "Páginas desconocidas: " << optarg << endl;
+        return -1;
+      }
+      op.arena = true;
+      op.paginas = TipoPaginas(p);
+      break;
+    }
+    case OPT_ESCALADO:
+      if (!leer_tamanio(optarg, op.tamanio_escalado)) {
+        cerr << "El tamaño del escalado debe ser un entero positivo" << endl;
+        return -1;
+      }
+      break;
+    case OPT_REGISTROS:
+      if (!leer_tamanio(optarg, op.tamanio_registros, MAX_ELEM_INDICES)) {
+        cerr << "El número de registros debe ser un entero positivo y no mayor que 2^32" << endl;
+        return -1;
+      }
+      break;
+    case OPT_PARCIAL:
+      if (!leer_tamanio(optarg, op.tamanio_parcial)) {
+        cerr << "El tamaño de la selección parcial debe ser un entero positivo" << endl;
+        return -1;
+      }
+      break;
+    case OPT_INCREMENTAL:
+      if (!leer_tamanio(optarg, op.tamanio_incremental)) {
+        cerr << "El tamaño de la inserción incremental debe ser un entero positivo" << endl;
+        return -1;
+      }
+      break;
+    case OPT_MAX_MUESTRAS:
+      if (!leer_entero(optarg, op.config.muestras_max, 1)) {
+        cerr << "El límite de muestras debe ser positivo" << endl;
+        return -1;
+      }
+      break;
+    case OPT_CALENTAMIENTO:
+      if (!leer_entero(optarg, op.config.calentamiento, 0)) {
+        cerr << "Las ejecuciones de calentamiento no pueden ser negativas"
+             << endl;
+        return -1;
+      }
+      break;
+    case OPT_PRECISION:
+      if (!leer_real(optarg, op.config.precision)) {
+        cerr << "La precisión debe ser un número positivo" << endl;
+        return -1;
+      }
+      break;
+    case OPT_TIEMPO_MAX:
+      if (!leer_real(optarg, op.config.tiempo_max)) {
+        cerr << "El tiempo máximo debe ser un número positivo" << endl;
+        return -1;
+      }
+      break;
+    case OPT_RELOJ:
+      if (string(optarg) == "tsc")
+        tipo_reloj = RELOJ_TSC;
+      else if (string(optarg) != "steady") {
+        cerr << "Reloj desconocido: " << optarg << endl;
+        return -1;
+      }
+      break;
+    case OPT_UMBRALES:
+      fichero_umbrales = optarg;
+      umbrales_explicitos = true;
+      break;
+    case OPT_CALIBRAR:
+      if (!leer_tamanio(optarg, op.tamanio_calibracion)) {
+        cerr << "El tamaño de la calibración debe ser un entero positivo" << endl;
+        return -1;
+      }
+      break;
+    case OPT_EXTERNO:
+      op.externo = optarg;
+      break;
+    case OPT_DATOS:
+      op.datos = optarg;
+      break;
+    case OPT_VERIFICAR:
+      verificar = true;
+      break;
+    case OPT_EN_SITIO:
+      op.en_sitio = true;
+      break;
+    case OPT_MEMORIA: {
+      long long mib;
+      if (!leer_entero(optarg, mib, 1, (long long) (SIZE_MAX >> 20))) {
+        cerr << "La memoria debe ser un número positivo de MiB" << endl;
+        return -1;
+      }
+      op.memoria_externo = (size_t) mib << 20;
+      break;
+    }
+    case OPT_GENERAR: {
+      Indice n;
+      if (!leer_tamanio(optarg, n)) {
+        cerr << "El número de elementos debe ser un entero positivo" << endl;
+        return -1;
+      }
+      op.generar = n;
+      break;
+    }
+    case OPT_PARTICION: {
+      int n = 0;
+      while (n < NUM_NUCLEOS && string(optarg) != nombre_nucleo(NucleoParticion(n)))
+        n++;
+      if (n == NUM_NUCLEOS) {
+        cerr << "Núcleo de partición desconocido: " << optarg << endl;
+        return -1;
+      }
+      if (!fijar_nucleo_particion(NucleoParticion(n))) {
+        cerr << "El procesador no ofrece el núcleo " << optarg << endl;
+        return -1;
+      }
+      break;
+    }
+    case 'h':
+      uso(argv[0]);
+      return 0;
+    default:
+      uso(argv[0]);
+      return -1;
+    }
+  }
+
+  // --verificar no escribe ficheros y no necesita directorio de salida
+  if (optind != argc - 1 && !(verificar && optind == argc)) {
+    uso(argv[0]);
+    return -1;
+  }
+  op.salida = optind < argc ? argv[optind] : ".";
+
+  if (op.config.muestras_max < op.config.muestras_min)
+    op.config.muestras_max = op.config.muestras_min;
+
+  // Sin --umbrales, umbrales.cfg es opcional
+  string error;
+  if (cargar_umbrales(fichero_umbrales, error))
+    cout << "Umbrales de " << fichero_umbrales << endl;
+  else if (umbrales_explicitos || std::ifstream(fichero_umbrales)) {
+    cerr << "Umbrales: " << error << endl;
+    return -1;
+  }
+
+  Reloj reloj(tipo_reloj);
+
+  ContadoresHW * contadores = NULL;
+  if (usar_contadores) {
+    contadores = new ContadoresHW;
+    if (!contadores->disponible())
+      cerr << "Contadores hardware no disponibles (" << contadores->error()
+           << "); se miden sólo tiempos" << endl;
+  }
+
+  planificador = new Planificador(op.hilos);
+
+  cout << "Núcleo de partición vectorial: "
+       << nombre_nucleo(nucleo_particion()) << endl;
+  int resultado = 0;
+  op.distribucion = distribuciones[0];
+  if (verificar) {
+    // Sin -a, -t o -d se verifican todos
+    if (!algoritmos_explicitos)
+      op.seleccion.assign(NUM_ALGORITMOS, true);
+    if (!tipos_explicitos)
+      tipos.assign(NUM_TIPOS, true);
+    if (!distribuciones_explicitas)
+      for (int d = 1; d < NUM_DISTRIBUCIONES; d++)
+        distribuciones.push_back(Distribucion{ TipoDistribucion(d), 0 });
+    cout << "Comparando los algoritmos con std::sort:" << endl;
+    int fallos = 0;
+    for (int t = 0; t < NUM_TIPOS; t++)
+      if (tipos[t])
+        fallos += TIPOS[t].verificar(op, distribuciones, TIPOS[t].nombre);
+    if (fallos == 0)
+      cout << "Todas las comprobaciones son correctas" << endl;
+    else
+      cerr << fallos << " comprobaciones fallidas" << endl;
+    delete contadores;
+    delete planificador;
+    return fallos == 0 ? 0 : -1;
+  }
+  if (!op.externo.empty()) {
+    int t = 0;
+    while (!tipos[t])
+      t++;
+    string sufijo = t == 0 ? "" : string("_") + TIPOS[t].nombre;
+    resultado = TIPOS[t].externo(op, sufijo);
+    delete contadores;
+    delete planificador;
+    return resultado;
+  }
+  if (!op.datos.empty()) {
+    int t = 0;
+    while (!tipos[t])
+      t++;
+    if (op.generar > 0)
+      resultado = TIPOS[t].generar(op, op.datos, true);
+    FicheroDatos f;
+    string error;
+    if (resultado == 0 && !f.abrir(op.datos, op.en_sitio ? DATOS_EN_SITIO
+                                                        : DATOS_PRIVADO, error)) {
+      cerr << "Datos: " << error << endl;
+      resultado = -1;
+    } else if (resultado == 0) {
+      t = f.tipo();
+      string sufijo = t == 0 ? "" : string("_") + TIPOS[t].nombre;
+      resultado = TIPOS[t].datos(op, sufijo, f, reloj);
+    }
+    delete contadores;
+    delete planificador;
+    return resultado;
+  }
+
+  nucleos = nucleos_fisicos();
+  if (op.afinidad && op.puntos > (int) nucleos.size()) {
+    cerr << "Sólo hay " << nucleos.size() << " núcleos físicos: se miden "
+         << nucleos.size() << " puntos a la vez" << endl;
+    op.puntos = nucleos.size();
+  }
+  if (op.afinidad) {
+    cout << "Hilos medidores en las cpu";
+    for (int w = 0; w < op.puntos; w++) {
+      string g = gobernador(nucleos[w].cpu);
+      cout << " " << nucleos[w].cpu;
+      if (g != "-")
+        cout << " (" << g << ")";
+      if (g != "-" && g != "performance")
+        cerr << "Aviso: la cpu " << nucleos[w].cpu << " usa el gobernador "
+             << g << "; su frecuencia puede cambiar entre puntos" << endl;
+    }
+    cout << endl;
+  }
+
+  cout << "Calculando la eficiencia empírica:" << endl << endl;
+  if (op.tamanio_escalado > 0)
+    resultado = escalado(op, reloj);
+  if (op.tamanio_registros > 0 && resultado == 0)
+    resultado = registros(op, reloj);
+  if (op.tamanio_parcial > 0 && resultado == 0)
+    resultado = parcial(op, reloj);
+  if (op.tamanio_incremental > 0 && resultado == 0)
+    resultado = incremental(op, reloj);
+  if (op.tamanio_calibracion > 0 && resultado == 0) {
+    for (int t = 0; t < NUM_TIPOS && resultado == 0; t++) {
+      if (!tipos[t])
+        continue;
+      string sufijo = t == 0 ? "" : string("_") + TIPOS[t].nombre;
+      resultado = TIPOS[t].calibrar(op, sufijo, reloj);
+    }
+    if (resultado == 0 && !guardar_umbrales(fichero_umbrales)) {
+      cerr << "No se puede escribir " << fichero_umbrales << endl;
+      resultado = -1;
+    } else if (resultado == 0) {
+      cout << "Umbrales guardados en " << fichero_umbrales << endl << endl;
+    }
+  }
+  for (size_t d = 0; d < distribuciones.size() && resultado == 0; d++) {
+    op.distribucion = distribuciones[d];
+    string sufijo_d = op.distribucion.tipo == UNIFORME ? "" :
+      string("_") + Generador::nombre(op.distribucion.tipo);
+    for (int t = 0; t < NUM_TIPOS && resultado == 0; t++) {
+      if (!tipos[t])
+        continue;
+      string sufijo = t == 0 ? "" : string("_") + TIPOS[t].nombre;
+      resultado = TIPOS[t].barrido(op, sufijo + sufijo_d, reloj, contadores);
+    }
+  }
+
+  delete contadores;
+  delete planificador;
+
+  return resultado;
+}
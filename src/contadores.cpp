@@ -0,0 +1,252 @@
+/**
+   @file contadores.cpp
+   @brief Contadores hardware de rendimiento (perf_event_open) por ejecución.
+   @date 2026-10-17
+*/
+
+
+#include "contadores.h"
+
+#include <cstring>
+#include <cerrno>
+#include <cstdint>
+#include <cmath>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+#ifdef __linux__
+
+/**
+   @brief Tipo y configuración de perf_event_attr de cada evento.
+*/
+struct DefinicionEvento {
+  uint32_t tipo;
+  uint64_t config;
+};
+
+#define CACHE(c, op, res) ((c) | ((op) << 8) | ((res) << 16))
+
+static const DefinicionEvento EVENTOS[NUM_EVENTOS] = {
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+  { PERF_TYPE_HW_CACHE, CACHE(PERF_COUNT_HW_CACHE_L1D,
+                              PERF_COUNT_HW_CACHE_OP_READ,
+                              PERF_COUNT_HW_CACHE_RESULT_MISS) },
+  { PERF_TYPE_HW_CACHE, CACHE(PERF_COUNT_HW_CACHE_LL,
+                              PERF_COUNT_HW_CACHE_OP_READ,
+                              PERF_COUNT_HW_CACHE_RESULT_MISS) },
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+  { PERF_TYPE_HW_CACHE, CACHE(PERF_COUNT_HW_CACHE_DTLB,
+                              PERF_COUNT_HW_CACHE_OP_READ,
+                              PERF_COUNT_HW_CACHE_RESULT_MISS) },
+};
+
+#undef CACHE
+
+
+/**
+   @brief Abre un evento, solo o en el grupo del descriptor lider.
+
+   El líder empieza deshabilitado y los demás miembros siguen al líder.
+*/
+static int abrir_evento(const DefinicionEvento & def, int lider)
+{
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = def.tipo;
+  attr.config = def.config;
+  attr.disabled = lider < 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                     PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return syscall(__NR_perf_event_open, &attr, 0, -1, lider, 0);
+}
+
+#endif
+
+
+ContadoresHW::ContadoresHW()
+  : error_(NULL)
+{
+  for (int e = 0; e < NUM_EVENTOS; e++) {
+    fd[e] = -1;
+    acumulado[e] = 0;
+    ejecuciones[e] = 0;
+  }
+#ifdef __linux__
+  abrir(true);
+  // Un grupo que pide más contadores de los que tiene el procesador no
+  // se planifica nunca; por separado, el núcleo los multiplexa
+  if (disponible() && !prueba()) {
+    cerrar();
+    abrir(false);
+  }
+#else
+  error_ = "perf_event_open sólo existe en Linux";
+#endif
+  if (disponible())
+    error_ = NULL;
+}
+
+
+ContadoresHW::~ContadoresHW()
+{
+  cerrar();
+}
+
+
+void ContadoresHW::abrir(bool agrupados)
+{
+#ifdef __linux__
+  int primero = -1;
+  for (int e = 0; e < NUM_EVENTOS; e++) {
+    bool miembro = agrupados && primero >= 0;
+    fd[e] = abrir_evento(EVENTOS[e], miembro ? fd[primero] : -1);
+    if (fd[e] < 0) {
+      if (error_ == NULL)
+        error_ = strerror(errno);
+      continue;
+    }
+    lider[e] = miembro ? primero : e;
+    habilitado[e] = contando[e] = 0;
+    if (primero < 0)
+      primero = e;
+  }
+#else
+  (void) agrupados;
+#endif
+}
+
+
+void ContadoresHW::cerrar()
+{
+#ifdef __linux__
+  for (int e = 0; e < NUM_EVENTOS; e++)
+    if (fd[e] >= 0) {
+      close(fd[e]);
+      fd[e] = -1;
+    }
+#endif
+}
+
+
+bool ContadoresHW::prueba()
+{
+  iniciar();
+  volatile uint64_t x = 0;
+  for (int i = 0; i < 100000; i++)
+    x += i;
+  bool bien = true;
+#ifdef __linux__
+  for (int e = 0; e < NUM_EVENTOS; e++)
+    if (fd[e] >= 0 && lider[e] == e) {
+      ioctl(fd[e], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+      bien = leer_grupo(e, false) && bien;
+    }
+#endif
+  return bien;
+}
+
+
+bool ContadoresHW::disponible() const
+{
+  for (int e = 0; e < NUM_EVENTOS; e++)
+    if (fd[e] >= 0)
+      return true;
+  return false;
+}
+
+
+void ContadoresHW::iniciar()
+{
+#ifdef __linux__
+  for (int e = 0; e < NUM_EVENTOS; e++)
+    if (fd[e] >= 0 && lider[e] == e) {
+      ioctl(fd[e], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(fd[e], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+
+void ContadoresHW::detener()
+{
+#ifdef __linux__
+  for (int e = 0; e < NUM_EVENTOS; e++)
+    if (fd[e] >= 0 && lider[e] == e)
+      ioctl(fd[e], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+  for (int e = 0; e < NUM_EVENTOS; e++)
+    if (fd[e] >= 0 && lider[e] == e)
+      leer_grupo(e, true);
+#endif
+}
+
+
+bool ContadoresHW::leer_grupo(int l, bool acumular)
+{
+#ifdef __linux__
+  // Número de eventos, tiempo habilitado, tiempo contando y un valor
+  // por evento, en el orden en que entraron en el grupo
+  uint64_t lectura[3 + NUM_EVENTOS];
+  if (read(fd[l], lectura, sizeof(lectura)) < (ssize_t) (3 * sizeof(uint64_t)))
+    return false;
+  // RESET no pone a cero los tiempos: cuenta la diferencia con la
+  // lectura anterior, la de esta ejecución
+  uint64_t h = lectura[1] - habilitado[l];
+  uint64_t c = lectura[2] - contando[l];
+  habilitado[l] = lectura[1];
+  contando[l] = lectura[2];
+  if (c == 0)
+    return false;
+  if (!acumular)
+    return true;
+  double escala = c < h ? (double) h / c : 1;
+  uint64_t i = 0;
+  for (int e = 0; e < NUM_EVENTOS && i < lectura[0]; e++)
+    if (fd[e] >= 0 && lider[e] == l) {
+      acumulado[e] += lectura[3 + i++] * escala;
+      ejecuciones[e]++;
+    }
+  return true;
+#else
+  (void) l;
+  (void) acumular;
+  return false;
+#endif
+}
+
+
+void ContadoresHW::reiniciar()
+{
+  for (int e = 0; e < NUM_EVENTOS; e++) {
+    acumulado[e] = 0;
+    ejecuciones[e] = 0;
+  }
+}
+
+
+double ContadoresHW::media(Evento e) const
+{
+  if (fd[e] < 0 || ejecuciones[e] == 0)
+    return NAN;
+  return acumulado[e] / ejecuciones[e];
+}
+
+
+const char * ContadoresHW::nombre(Evento e)
+{
+  static const char * NOMBRES[NUM_EVENTOS] = {
+    "ciclos", "instrucciones", "fallos_l1d", "fallos_llc",
+    "fallos_salto", "fallos_dtlb"
+  };
+  return NOMBRES[e];
+}
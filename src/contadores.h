@@ -0,0 +1,121 @@
+/**
+   @file contadores.h
+   @brief Contadores hardware de rendimiento (perf_event_open) por ejecución.
+   @date 2026-10-17
+*/
+
+#ifndef CONTADORES_H
+#define CONTADORES_H
+
+#include <cstdint>
+
+
+/**
+   @brief Eventos hardware que se cuentan alrededor de la región medida.
+*/
+enum Evento {
+  CICLOS,
+  INSTRUCCIONES,
+  FALLOS_L1D,
+  FALLOS_LLC,
+  FALLOS_SALTO,
+  FALLOS_DTLB,
+  NUM_EVENTOS
+};
+
+
+/**
+   @brief Conjunto de contadores hardware del proceso actual.
+
+   Abre un descriptor de perf_event_open por evento, sólo en modo
+   usuario. Los eventos que el núcleo o el procesador no ofrecen (por
+   ejemplo dentro de un contenedor, o con perf_event_paranoid alto) se
+   quedan sin abrir y se informan como no disponibles; el resto sigue
+   funcionando.
+
+   Los eventos forman un grupo (PERF_FORMAT_GROUP): el núcleo los
+   cuenta siempre a la vez, de modo que los cocientes entre ellos (IPC,
+   fallos por instrucción) salen de la misma ventana. Si el procesador
+   no tiene contadores para todo el grupo, que entonces no llegaría a
+   contar, cada evento se abre por separado. Si el núcleo multiplexa
+   los contadores, lo contado en cada ejecución se escala con la parte
+   de esa ejecución en que estuvieron activos.
+*/
+class ContadoresHW {
+public:
+  ContadoresHW();
+  ~ContadoresHW();
+
+  /**
+     @brief Indica si se pudo abrir algún contador.
+  */
+  bool disponible() const;
+
+  /**
+     @brief Indica si se pudo abrir el contador del evento e.
+  */
+  bool disponible(Evento e) const { return fd[e] >= 0; }
+
+  /**
+     @brief Motivo por el que no hay ningún contador disponible.
+  */
+  const char * error() const { return error_; }
+
+  /**
+     @brief Pone a cero los contadores y empieza a contar.
+  */
+  void iniciar();
+
+  /**
+     @brief Deja de contar y suma lo contado a los acumulados.
+  */
+  void detener();
+
+  /**
+     @brief Borra los acumulados y el número de ejecuciones.
+  */
+  void reiniciar();
+
+  /**
+     @brief Valor medio del evento e por ejecución desde el último
+     reiniciar(), sin las ejecuciones en que su grupo no llegó a contar.
+  */
+  double media(Evento e) const;
+
+  static const char * nombre(Evento e);
+
+private:
+  /**
+     @brief Abre los eventos, en un único grupo o cada uno en el suyo.
+  */
+  void abrir(bool agrupados);
+
+  void cerrar();
+
+  /**
+     @brief Cuenta una ejecución vacía y comprueba que todos los grupos
+     han llegado a contar.
+  */
+  bool prueba();
+
+  /**
+     @brief Lee el grupo que encabeza el evento l y, si acumular, suma a
+     sus eventos lo contado desde iniciar().
+     @return false si el grupo no ha contado nada en ese tiempo.
+  */
+  bool leer_grupo(int l, bool acumular);
+
+  int fd[NUM_EVENTOS];
+  int lider[NUM_EVENTOS];         ///< Evento que encabeza el grupo de cada uno.
+  uint64_t habilitado[NUM_EVENTOS];  ///< Última lectura de cada líder.
+  uint64_t contando[NUM_EVENTOS];    ///< Última lectura de cada líder.
+  double acumulado[NUM_EVENTOS];
+  int ejecuciones[NUM_EVENTOS];   ///< Ejecuciones contadas de cada evento.
+  const char * error_;
+
+  ContadoresHW(const ContadoresHW &);
+  ContadoresHW & operator=(const ContadoresHW &);
+};
+
+
+#endif
@@ -0,0 +1,155 @@
+/**
+   @file datos.cpp
+   @brief Ficheros binarios de datos con cabecera, proyectados en memoria.
+   @date 2026-10-17
+*/
+
+
+#include "datos.h"
+
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+static const char MAGIA[8] = "ORDENAR";
+
+static const char * NOMBRES[NUM_TIPOS_DATO] = {
+  "float", "double", "uint32", "uint64", "registro"
+};
+
+static const uint32_t TAMANIOS[NUM_TIPOS_DATO] = {
+  sizeof(float), sizeof(double), sizeof(uint32_t), sizeof(uint64_t),
+  sizeof(Registro)
+};
+
+
+const char * nombre_tipo_dato(TipoDato t)
+{
+  return NOMBRES[t];
+}
+
+
+FicheroDatos::FicheroDatos()
+  : base(NULL), bytes(0), modo(DATOS_PRIVADO), cabecera(NULL)
+{
+}
+
+
+FicheroDatos::~FicheroDatos()
+{
+  cerrar();
+}
+
+
+bool FicheroDatos::abrir(const std::string & nombre, ModoDatos modo,
+                         std::string & error)
+{
+  cerrar();
+  int fd = open(nombre.c_str(), modo == DATOS_EN_SITIO ? O_RDWR : O_RDONLY);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) != 0) {
+    error = "no se puede abrir " + nombre + ": " + strerror(errno);
+    if (fd >= 0)
+      close(fd);
+    return false;
+  }
+  if ((size_t) st.st_size < sizeof(CabeceraDatos)) {
+    close(fd);
+    error = nombre + " no tiene cabecera";
+    return false;
+  }
+
+  int proteccion = PROT_READ | PROT_WRITE;
+  int opciones = modo == DATOS_EN_SITIO ? MAP_SHARED : MAP_PRIVATE;
+  void * p = mmap(NULL, st.st_size, proteccion, opciones, fd, 0);
+  close(fd);
+  if (p == MAP_FAILED) {
+    error = "no se puede proyectar " + nombre + ": " + strerror(errno);
+    return false;
+  }
+  base = static_cast<char *>(p);
+  bytes = st.st_size;
+  this->modo = modo;
+  cabecera = reinterpret_cast<const CabeceraDatos *>(base);
+
+  const CabeceraDatos & c = *cabecera;
+  if (memcmp(c.magia, MAGIA, sizeof(MAGIA)) != 0)
+    error = nombre + " no es un fichero de datos";
+  else if (c.marca != MARCA_DATOS)
+    error = nombre + " se escribió con el orden de bytes contrario";
+  else if (c.version != VERSION_DATOS)
+    error = nombre + " tiene una versión desconocida";
+  else if (c.tipo >= NUM_TIPOS_DATO || c.tamanio != TAMANIOS[c.tipo])
+    error = nombre + " tiene un tipo de elemento desconocido";
+  else if (c.num_elem > (bytes - sizeof(CabeceraDatos)) / c.tamanio)
+    error = nombre + " es más corto de lo que indica su cabecera";
+  else
+    return true;
+  cerrar();
+  return false;
+}
+
+
+void FicheroDatos::cerrar()
+{
+  if (base != NULL)
+    munmap(base, bytes);
+  base = NULL;
+  bytes = 0;
+  cabecera = NULL;
+}
+
+
+void FicheroDatos::cargar()
+{
+  long pagina = sysconf(_SC_PAGESIZE);
+  madvise(base, bytes, MADV_WILLNEED);
+  volatile char * p = base;
+  for (size_t i = 0; i < bytes; i += pagina)
+    p[i] = p[i];
+}
+
+
+bool FicheroDatos::sincronizar()
+{
+  return modo != DATOS_EN_SITIO || msync(base, bytes, MS_SYNC) == 0;
+}
+
+
+bool escribir_cabecera_datos(FILE * f, TipoDato tipo, uint32_t tamanio,
+                             uint64_t num_elem)
+{
+  CabeceraDatos c;
+  memset(&c, 0, sizeof(c));
+  memcpy(c.magia, MAGIA, sizeof(MAGIA));
+  c.marca = MARCA_DATOS;
+  c.version = VERSION_DATOS;
+  c.tipo = tipo;
+  c.tamanio = tamanio;
+  c.num_elem = num_elem;
+  return fwrite(&c, sizeof(c), 1, f) == 1;
+}
+
+
+bool escribir_datos(const std::string & nombre, TipoDato tipo,
+                    uint32_t tamanio, const void * datos, uint64_t num_elem,
+                    std::string & error)
+{
+  FILE * f = fopen(nombre.c_str(), "wb");
+  if (f == NULL) {
+    error = "no se puede crear " + nombre + ": " + strerror(errno);
+    return false;
+  }
+  setvbuf(f, NULL, _IONBF, 0);
+  bool bien = escribir_cabecera_datos(f, tipo, tamanio, num_elem)
+    && fwrite(datos, tamanio, num_elem, f) == num_elem;
+  if (fclose(f) != 0 || !bien) {
+    error = "no se puede escribir " + nombre;
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,158 @@
+/**
+   @file datos.h
+   @brief Ficheros binarios de datos con cabecera, proyectados en memoria.
+   @date 2026-10-17
+*/
+
+#ifndef DATOS_H
+#define DATOS_H
+
+#include "tipos.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+
+/**
+   @brief Tipo de los elementos de un fichero de datos.
+*/
+enum TipoDato {
+  DATO_FLOAT,
+  DATO_DOUBLE,
+  DATO_UINT32,
+  DATO_UINT64,
+  DATO_REGISTRO,
+  NUM_TIPOS_DATO
+};
+
+
+/**
+   @brief Cabecera de un fichero de datos.
+
+   Ocupa 64 bytes, de modo que los elementos, que van detrás, quedan
+   alineados a una línea de caché al proyectar el fichero. marca se
+   escribe con el orden de bytes de la máquina que crea el fichero y
+   permite detectar ficheros de máquinas con el orden contrario.
+*/
+struct CabeceraDatos {
+  char magia[8];          ///< "ORDENAR" terminado en '\0'.
+  uint32_t marca;         ///< MARCA_DATOS en el orden de quien escribe.
+  uint32_t version;
+  uint32_t tipo;          ///< TipoDato.
+  uint32_t tamanio;       ///< Bytes por elemento.
+  uint64_t num_elem;
+  char reservado[32];
+};
+
+const uint32_t MARCA_DATOS = 0x01020304;
+const uint32_t VERSION_DATOS = 1;
+
+
+/**
+   @brief Forma de proyectar un fichero de datos.
+*/
+enum ModoDatos {
+  DATOS_PRIVADO,          ///< Copia privada: el fichero no cambia.
+  DATOS_EN_SITIO          ///< Compartida: se ordena el propio fichero.
+};
+
+
+/**
+   @brief Fichero de datos proyectado en memoria.
+
+   Los algoritmos trabajan directamente sobre la proyección, sin copiar
+   los elementos. Con DATOS_PRIVADO las páginas modificadas se copian
+   al escribirlas (copy-on-write) y el fichero no cambia; con
+   DATOS_EN_SITIO los cambios se escriben en el propio fichero.
+*/
+class FicheroDatos {
+public:
+  FicheroDatos();
+  ~FicheroDatos();
+
+  /**
+     @brief Proyecta el fichero nombre.
+     @return false si no se puede abrir o su cabecera no es válida, con
+             la descripción en error.
+  */
+  bool abrir(const std::string & nombre, ModoDatos modo, std::string & error);
+
+  /**
+     @brief Deshace la proyección. Con DATOS_EN_SITIO los cambios
+     pendientes los escribe el sistema después.
+  */
+  void cerrar();
+
+  /**
+     @brief Trae a memoria todas las páginas de los elementos.
+
+     Escribe en cada página, de modo que los fallos de página de la
+     primera escritura (la copia privada con DATOS_PRIVADO, marcarla
+     como modificada con DATOS_EN_SITIO) ocurren ahora y no durante la
+     ordenación.
+  */
+  void cargar();
+
+  /**
+     @brief Escribe en el fichero los cambios de una proyección en sitio.
+     @return false si msync falla.
+  */
+  bool sincronizar();
+
+  TipoDato tipo() const { return TipoDato(cabecera->tipo); }
+  uint64_t num_elem() const { return cabecera->num_elem; }
+  void * datos() const { return base + sizeof(CabeceraDatos); }
+
+private:
+  char * base;
+  size_t bytes;
+  ModoDatos modo;
+  const CabeceraDatos * cabecera;
+
+  FicheroDatos(const FicheroDatos &);
+  FicheroDatos & operator=(const FicheroDatos &);
+};
+
+
+/**
+   @brief Escribe la cabecera de un fichero de datos, al que después se
+   añaden los num_elem elementos en binario.
+   @return false si no se puede escribir.
+*/
+bool escribir_cabecera_datos(FILE * f, TipoDato tipo, uint32_t tamanio,
+                             uint64_t num_elem);
+
+
+/**
+   @brief Escribe un fichero de datos completo.
+
+   @param nombre: ruta del fichero.
+   @param tipo: tipo de los elementos.
+   @param tamanio: bytes por elemento.
+   @param datos: elementos.
+   @param num_elem: número de elementos.
+   @param error: descripción del error, si lo hay. Es MODIFICADO.
+   @return false si no se puede escribir.
+*/
+bool escribir_datos(const std::string & nombre, TipoDato tipo,
+                    uint32_t tamanio, const void * datos, uint64_t num_elem,
+                    std::string & error);
+
+
+const char * nombre_tipo_dato(TipoDato t);
+
+
+/**
+   @brief TipoDato de cada tipo de elemento de tipos.h.
+*/
+template <class Tipo> struct DatoDe;
+template <> struct DatoDe<float>    { static const TipoDato tipo = DATO_FLOAT; };
+template <> struct DatoDe<double>   { static const TipoDato tipo = DATO_DOUBLE; };
+template <> struct DatoDe<uint32_t> { static const TipoDato tipo = DATO_UINT32; };
+template <> struct DatoDe<uint64_t> { static const TipoDato tipo = DATO_UINT64; };
+template <> struct DatoDe<Registro> { static const TipoDato tipo = DATO_REGISTRO; };
+
+
+#endif
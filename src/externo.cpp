@@ -0,0 +1,86 @@
+/**
+   @file externo.cpp
+   @brief Ordenación externa de ficheros mayores que la memoria.
+   @date 2026-10-17
+*/
+
+
+#include "externo.h"
+
+
+HiloES::HiloES()
+  : terminar(false)
+{
+  hilo = std::thread(&HiloES::bucle, this);
+}
+
+
+HiloES::~HiloES()
+{
+  {
+    std::lock_guard<std::mutex> l(m);
+    terminar = true;
+  }
+  hay_tareas.notify_one();
+  hilo.join();
+}
+
+
+std::future<void> HiloES::encargar(std::function<void()> tarea)
+{
+  std::packaged_task<void()> t(tarea);
+  std::future<void> f = t.get_future();
+  {
+    std::lock_guard<std::mutex> l(m);
+    cola.push_back(std::move(t));
+  }
+  hay_tareas.notify_one();
+  return f;
+}
+
+
+void HiloES::bucle()
+{
+  while (true) {
+    std::packaged_task<void()> t;
+    {
+      std::unique_lock<std::mutex> l(m);
+      hay_tareas.wait(l, [this]() { return terminar || !cola.empty(); });
+      // Las tareas pendientes se terminan antes de salir
+      if (cola.empty())
+        return;
+      t = std::move(cola.front());
+      cola.pop_front();
+    }
+    t();
+  }
+}
+
+
+size_t leer_bloque(FILE * f, void * datos, size_t bytes)
+{
+  char * p = static_cast<char *>(datos);
+  size_t leidos = 0;
+  while (leidos < bytes) {
+    size_t r = fread(p + leidos, 1, bytes - leidos, f);
+    if (r == 0)
+      break;
+    leidos += r;
+  }
+  return leidos;
+}
+
+
+bool escribir_bloque(FILE * f, const void * datos, size_t bytes)
+{
+  return fwrite(datos, 1, bytes, f) == bytes;
+}
+
+
+FILE * abrir_sin_bufer(const std::string & nombre, const char * modo)
+{
+  FILE * f = fopen(nombre.c_str(), modo);
+  if (f != NULL)
+    setvbuf(f, NULL, _IONBF, 0);
+  return f;
+}
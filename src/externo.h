@@ -0,0 +1,440 @@
+/**
+   @file externo.h
+   @brief Ordenación externa de ficheros mayores que la memoria.
+   @date 2026-10-17
+*/
+
+#ifndef EXTERNO_H
+#define EXTERNO_H
+
+#include "tipos.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+/**
+   @brief Hilo que ejecuta en orden las lecturas y escrituras encargadas.
+
+   Mientras el hilo principal ordena o mezcla, este hilo lee por
+   adelantado el siguiente bloque y escribe el anterior. Todas las
+   operaciones de E/S de una ordenación externa pasan por él, así que
+   se ejecutan de una en una y en el orden en que se encargan.
+*/
+class HiloES {
+public:
+  HiloES();
+  ~HiloES();
+
+  /**
+     @brief Encarga una operación.
+     @return futuro que queda listo cuando la operación termina.
+  */
+  std::future<void> encargar(std::function<void()> tarea);
+
+private:
+  std::thread hilo;
+  std::mutex m;
+  std::condition_variable hay_tareas;
+  std::deque<std::packaged_task<void()> > cola;
+  bool terminar;
+
+  void bucle();
+
+  HiloES(const HiloES &);
+  HiloES & operator=(const HiloES &);
+};
+
+
+/**
+   @brief Volumen de E/S y tiempo de una fase de la ordenación externa.
+*/
+struct FaseExterna {
+  double segundos;
+  uint64_t leidos;        ///< Bytes leídos.
+  uint64_t escritos;      ///< Bytes escritos.
+
+  FaseExterna() : segundos(0), leidos(0), escritos(0) {}
+
+  /**
+     @brief Bytes leídos y escritos por segundo.
+  */
+  double caudal() const
+  {
+    return segundos > 0 ? (leidos + escritos) / segundos : 0;
+  }
+};
+
+
+/**
+   @brief Resultado de una ordenación externa.
+*/
+struct InformeExterno {
+  uint64_t elementos;
+  int tramos;             ///< Tramos ordenados en memoria.
+  int pasadas;            ///< Pasadas de mezcla.
+  int aridad;             ///< Tramos mezclados a la vez como máximo.
+  FaseExterna formacion;  ///< Lectura, ordenación y escritura de tramos.
+  FaseExterna mezcla;     ///< Mezclas de todas las pasadas.
+};
+
+
+/**
+   @brief Bloque mínimo de lectura de cada tramo en la mezcla.
+
+   Limita el número de tramos que se mezclan a la vez: con menos
+   memoria por tramo las lecturas dejarían de ser secuenciales.
+*/
+const size_t BLOQUE_MIN_EXTERNO = 1 << 20;
+
+
+/**
+   @brief Lee hasta bytes bytes de f.
+   @return bytes leídos; menos que bytes sólo al final del fichero o
+           si hay un error.
+*/
+size_t leer_bloque(FILE * f, void * datos, size_t bytes);
+
+
+/**
+   @brief Escribe bytes bytes en f.
+   @return false si no se pudieron escribir todos.
+*/
+bool escribir_bloque(FILE * f, const void * datos, size_t bytes);
+
+
+/**
+   @brief Abre un fichero sin el búfer de stdio, que sólo añadiría una copia
+   a las operaciones de bloques grandes.
+*/
+FILE * abrir_sin_bufer(const std::string & nombre, const char * modo);
+
+
+/**
+   @brief Ordena un fichero de elementos de tipo Tipo mayor que la memoria.
+
+   @param entrada: fichero con los elementos en binario, uno tras otro.
+   @param salida: fichero en el que se escriben ordenados.
+   @param temporal: directorio de los tramos intermedios.
+   @param memoria: bytes de memoria disponibles para los datos.
+   @param ordenar: ordenación en memoria de cada tramo.
+   @param informe: resultado de la ordenación. Es MODIFICADO.
+   @param error: descripción del error, si lo hay. Es MODIFICADO.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+   @return false si hay un error de E/S o de memoria.
+
+   Primero forma tramos de memoria / 2 bytes: mientras ordena uno con
+   ordenar en un búfer, el hilo de E/S escribe el tramo anterior y lee
+   el siguiente en el otro. Después mezcla los tramos de aridad en
+   aridad, leyendo cada tramo por bloques con uno de reserva que se
+   llena por adelantado y escribiendo la salida con dos búferes, hasta
+   que queda uno. La aridad es la mayor que permite bloques de
+   BLOQUE_MIN_EXTERNO bytes en la memoria dada.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+bool ordenar_externo(const std::string & entrada, const std::string & salida,
+                     const std::string & temporal, size_t memoria,
+                     void (*ordenar)(Tipo T[], Indice num_elem),
+                     InformeExterno & informe, std::string & error,
+                     Comparador comp = Comparador());
+
+
+/**
+   @brief Mezcla ficheros ordenados en uno.
+
+   @param tramos: ficheros a mezclar.
+   @param destino: fichero mezclado.
+   @param memoria: bytes de memoria para los búferes.
+   @param es: hilo de E/S.
+   @param fase: volumen de E/S de la mezcla. Es MODIFICADO.
+   @param comp: orden estricto entre elementos.
+   @return false si hay un error de E/S.
+*/
+template <class Tipo, class Comparador>
+bool mezclar_externo(const std::vector<std::string> & tramos,
+                     const std::string & destino, size_t memoria,
+                     HiloES & es, FaseExterna & fase, Comparador comp);
+
+
+
+/**
+   Implementación de las funciones
+**/
+
+
+/**
+   @brief Nombre del fichero temporal de un tramo de una pasada.
+*/
+inline std::string nombre_tramo(const std::string & temporal, int pasada,
+                                int tramo)
+{
+  std::ostringstream ss;
+  ss << temporal << "/tramo_" << pasada << "_" << tramo << ".tmp";
+  return ss.str();
+}
+
+
+template <class Tipo, class Comparador>
+bool ordenar_externo(const std::string & entrada, const std::string & salida,
+                     const std::string & temporal, size_t memoria,
+                     void (*ordenar)(Tipo T[], Indice num_elem),
+                     InformeExterno & informe, std::string & error,
+                     Comparador comp)
+{
+  typedef std::chrono::steady_clock Reloj;
+  informe = InformeExterno();
+
+  // Dos búferes de tramo
+  size_t capacidad = memoria / 2 / sizeof(Tipo);
+  size_t bloque_min = BLOQUE_MIN_EXTERNO / sizeof(Tipo);
+  if (capacidad < bloque_min) {
+    error = "la memoria no llega para dos bloques";
+    return false;
+  }
+  informe.aridad =
+    std::max<size_t>(2, memoria / sizeof(Tipo) / bloque_min / 2 - 1);
+
+  FILE * f = abrir_sin_bufer(entrada, "rb");
+  if (f == NULL) {
+    error = "no se puede abrir " + entrada;
+    return false;
+  }
+
+  std::vector<Tipo> buf[2];
+  try {
+    buf[0].resize(capacidad);
+    buf[1].resize(capacidad);
+  } catch (std::bad_alloc &) {
+    fclose(f);
+    error = "no hay memoria para los búferes de tramo";
+    return false;
+  }
+
+  // Formación de tramos
+  HiloES es;
+  std::vector<std::string> tramos;
+  std::atomic<bool> fallo(false);
+  FaseExterna & formacion = informe.formacion;
+  Reloj::time_point t0 = Reloj::now();
+
+  size_t n[2];
+  n[0] = leer_bloque(f, &buf[0][0], capacidad * sizeof(Tipo)) / sizeof(Tipo);
+  formacion.leidos += n[0] * sizeof(Tipo);
+
+  auto escribir_tramo = [&](int b) {
+    std::string nombre = nombre_tramo(temporal, 0, tramos.size());
+    tramos.push_back(nombre);
+    FILE * g = abrir_sin_bufer(nombre, "wb");
+    if (g == NULL || !escribir_bloque(g, &buf[b][0], n[b] * sizeof(Tipo)))
+      fallo = true;
+    if (g != NULL)
+      fclose(g);
+    formacion.escritos += n[b] * sizeof(Tipo);
+  };
+
+  int a = 0;
+  bool pendiente = false;
+  while (n[a] > 0 && !fallo) {
+    int b = 1 - a;
+    bool escribir = pendiente;
+    std::future<void> es_b = es.encargar([&, b, escribir]() {
+        if (escribir)
+          escribir_tramo(b);
+        n[b] = leer_bloque(f, &buf[b][0], capacidad * sizeof(Tipo)) / sizeof(Tipo);
+        formacion.leidos += n[b] * sizeof(Tipo);
+      });
+    ordenar(&buf[a][0], n[a]);
+    informe.elementos += n[a];
+    es_b.get();
+    pendiente = true;
+    a = b;
+  }
+  if (pendiente && !fallo)
+    escribir_tramo(1 - a);
+  if (ferror(f))
+    fallo = true;
+  fclose(f);
+  formacion.segundos =
+    std::chrono::duration<double>(Reloj::now() - t0).count();
+  informe.tramos = tramos.size();
+
+  buf[0] = std::vector<Tipo>();
+  buf[1] = std::vector<Tipo>();
+  if (fallo) {
+    error = "error de E/S al formar los tramos";
+    return false;
+  }
+
+  // Mezcla por pasadas, hasta que queda un único fichero
+  t0 = Reloj::now();
+  if (tramos.empty()) {
+    FILE * g = abrir_sin_bufer(salida, "wb");
+    if (g == NULL || fclose(g) != 0)
+      fallo = true;
+  } else if (tramos.size() == 1
+             && rename(tramos[0].c_str(), salida.c_str()) != 0) {
+    // rename no cruza sistemas de ficheros: se copia mezclando un solo tramo
+    fallo = !mezclar_externo<Tipo>(tramos, salida, memoria, es,
+                                   informe.mezcla, comp);
+    remove(tramos[0].c_str());
+  }
+  for (int pasada = 1; tramos.size() > 1 && !fallo; pasada++) {
+    std::vector<std::string> siguientes;
+    for (size_t i = 0; i < tramos.size() && !fallo; i += informe.aridad) {
+      size_t fin = std::min(tramos.size(), i + informe.aridad);
+      std::vector<std::string> grupo(tramos.begin() + i, tramos.begin() + fin);
+      std::string destino = tramos.size() <= (size_t) informe.aridad ?
+        salida : nombre_tramo(temporal, pasada, siguientes.size());
+      siguientes.push_back(destino);
+      fallo = !mezclar_externo<Tipo>(grupo, destino, memoria, es,
+                                     informe.mezcla, comp);
+      for (size_t j = 0; j < grupo.size(); j++)
+        remove(grupo[j].c_str());
+    }
+    tramos = siguientes;
+    informe.pasadas = pasada;
+  }
+  informe.mezcla.segundos =
+    std::chrono::duration<double>(Reloj::now() - t0).count();
+
+  if (fallo) {
+    error = "error de E/S al mezclar los tramos";
+    return false;
+  }
+  return true;
+}
+
+
+template <class Tipo, class Comparador>
+bool mezclar_externo(const std::vector<std::string> & tramos,
+                     const std::string & destino, size_t memoria,
+                     HiloES & es, FaseExterna & fase, Comparador comp)
+{
+  struct Entrada {
+    FILE * f;
+    std::vector<Tipo> bloque[2];
+    size_t n[2];
+    size_t pos;
+    int activo;
+    std::future<void> reserva;
+  };
+
+  int k = tramos.size();
+  size_t tamanio = std::max<size_t>(1, memoria / sizeof(Tipo) / (2 * (k + 1)));
+  std::atomic<bool> fallo(false);
+
+  auto leer = [&](Entrada * e, int b) {
+    e->n[b] = leer_bloque(e->f, &e->bloque[b][0], tamanio * sizeof(Tipo))
+      / sizeof(Tipo);
+    if (ferror(e->f))
+      fallo = true;
+    fase.leidos += e->n[b] * sizeof(Tipo);
+  };
+
+  std::vector<Entrada> entradas(k);
+  for (int i = 0; i < k; i++) {
+    Entrada & e = entradas[i];
+    e.f = abrir_sin_bufer(tramos[i], "rb");
+    e.pos = 0;
+    e.activo = 0;
+    e.n[0] = e.n[1] = 0;
+    if (e.f == NULL) {
+      fallo = true;
+      continue;
+    }
+    e.bloque[0].resize(tamanio);
+    e.bloque[1].resize(tamanio);
+  }
+  FILE * g = abrir_sin_bufer(destino, "wb");
+  if (g == NULL)
+    fallo = true;
+
+  // Primer bloque de cada tramo y, por adelantado, el de reserva
+  typedef std::pair<Tipo, int> Cabeza;
+  std::vector<Cabeza> monton;
+  for (int i = 0; i < k && !fallo; i++) {
+    Entrada * e = &entradas[i];
+    es.encargar([&, e]() { leer(e, 0); }).get();
+    if (e->n[0] > 0) {
+      monton.push_back(Cabeza(e->bloque[0][0], i));
+      e->reserva = es.encargar([&, e]() { leer(e, 1); });
+    }
+  }
+
+  // Montón de mínimos sobre las cabezas de los tramos
+  auto mayor = [&](const Cabeza & x, const Cabeza & y) {
+    return comp(y.first, x.first);
+  };
+  std::make_heap(monton.begin(), monton.end(), mayor);
+
+  std::vector<Tipo> salida[2];
+  salida[0].resize(tamanio);
+  salida[1].resize(tamanio);
+  int s = 0;
+  size_t usados = 0;
+  std::future<void> escritura;
+  auto escribir = [&](int b, size_t cuantos) {
+    if (escritura.valid())
+      escritura.get();
+    escritura = es.encargar([&, b, cuantos]() {
+        if (!escribir_bloque(g, &salida[b][0], cuantos * sizeof(Tipo)))
+          fallo = true;
+        fase.escritos += cuantos * sizeof(Tipo);
+      });
+  };
+
+  while (!monton.empty() && !fallo) {
+    std::pop_heap(monton.begin(), monton.end(), mayor);
+    Cabeza & c = monton.back();
+    salida[s][usados++] = c.first;
+    if (usados == tamanio) {
+      escribir(s, usados);
+      s = 1 - s;
+      usados = 0;
+    }
+
+    Entrada * e = &entradas[c.second];
+    if (++e->pos == e->n[e->activo]) {
+      e->reserva.get();
+      e->activo = 1 - e->activo;
+      e->pos = 0;
+      if (e->n[e->activo] == 0) {
+        monton.pop_back();
+        continue;
+      }
+      int libre = 1 - e->activo;
+      e->reserva = es.encargar([&, e, libre]() { leer(e, libre); });
+    }
+    c.first = e->bloque[e->activo][e->pos];
+    std::push_heap(monton.begin(), monton.end(), mayor);
+  }
+  if (usados > 0 && !fallo)
+    escribir(s, usados);
+  if (escritura.valid())
+    escritura.get();
+
+  for (int i = 0; i < k; i++) {
+    if (entradas[i].reserva.valid())
+      entradas[i].reserva.get();
+    if (entradas[i].f != NULL)
+      fclose(entradas[i].f);
+  }
+  if (g != NULL && fclose(g) != 0)
+    fallo = true;
+  return !fallo;
+}
+
+
+#endif
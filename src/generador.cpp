@@ -0,0 +1,223 @@
+/**
+   @file generador.cpp
+   @brief Generación reproducible de vectores de entrada con varias distribuciones.
+   @date 2026-10-17
+*/
+
+
+#include "generador.h"
+#include "quicksort.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+
+
+static const uint64_t MAXIMO = (uint64_t) 1 << 31;
+
+static const char * NOMBRES[NUM_DISTRIBUCIONES] = {
+  "uniforme", "ordenado", "inverso", "casi_ordenado", "pocos_valores",
+  "organo", "sierra", "zipf", "gaussiana", "adversario"
+};
+
+
+Generador::Generador(const Distribucion & d, uint64_t semilla)
+  : distribucion(d), motor(semilla)
+{
+}
+
+
+const char * Generador::nombre(TipoDistribucion d)
+{
+  return NOMBRES[d];
+}
+
+
+std::string Generador::descripcion() const
+{
+  std::ostringstream ss;
+  ss << NOMBRES[distribucion.tipo];
+  if (distribucion.parametro != 0)
+    ss << ":" << distribucion.parametro;
+  return ss.str();
+}
+
+
+bool Generador::leer(const std::string & texto, Distribucion & d)
+{
+  std::string::size_type dos_puntos = texto.find(':');
+  std::string nombre = texto.substr(0, dos_puntos);
+  d.parametro = 0;
+  if (dos_puntos != std::string::npos) {
+    char * fin;
+    d.parametro = strtod(texto.c_str() + dos_puntos + 1, &fin);
+    if (*fin != '\0' || d.parametro < 0)
+      return false;
+  }
+  for (int i = 0; i < NUM_DISTRIBUCIONES; i++)
+    if (nombre == NOMBRES[i]) {
+      d.tipo = TipoDistribucion(i);
+      return true;
+    }
+  return false;
+}
+
+
+void Generador::generar(uint64_t claves[], Indice num_elem)
+{
+  double p = distribucion.parametro;
+  Indice i;
+
+  switch (distribucion.tipo) {
+  case UNIFORME:
+    for (i = 0; i < num_elem; i++)
+      claves[i] = motor() % MAXIMO;
+    break;
+
+  case ORDENADO:
+    for (i = 0; i < num_elem; i++)
+      claves[i] = i;
+    break;
+
+  case INVERSO:
+    for (i = 0; i < num_elem; i++)
+      claves[i] = num_elem - 1 - i;
+    break;
+
+  case CASI_ORDENADO: {
+    Indice intercambios = p > 0 ? (Indice) p : std::max<Indice>(1, num_elem / 100);
+    for (i = 0; i < num_elem; i++)
+      claves[i] = i;
+    for (Indice k = 0; k < intercambios; k++)
+      std::swap(claves[motor() % num_elem], claves[motor() % num_elem]);
+    break;
+  }
+
+  case POCOS_VALORES: {
+    uint64_t valores = p > 0 ? (uint64_t) p : 16;
+    for (i = 0; i < num_elem; i++)
+      claves[i] = (motor() % valores) * (MAXIMO / valores);
+    break;
+  }
+
+  case ORGANO:
+    for (i = 0; i < num_elem; i++)
+      claves[i] = i < num_elem / 2 ? i : num_elem - 1 - i;
+    break;
+
+  case SIERRA: {
+    Indice tramos = p > 0 ? (Indice) p : 16;
+    Indice periodo = std::max<Indice>(1, num_elem / tramos);
+    for (i = 0; i < num_elem; i++)
+      claves[i] = i % periodo;
+    break;
+  }
+
+  case ZIPF: {
+    preparar_zipf(num_elem);
+    std::uniform_real_distribution<double> u(0, 1);
+    for (i = 0; i < num_elem; i++)
+      claves[i] = std::lower_bound(acumulada.begin(), acumulada.end(), u(motor))
+                  - acumulada.begin();
+    break;
+  }
+
+  case GAUSSIANA: {
+    std::normal_distribution<double> normal(MAXIMO / 2, MAXIMO / 8);
+    for (i = 0; i < num_elem; i++) {
+      double x = normal(motor);
+      claves[i] = x < 0 ? 0 : x >= MAXIMO ? MAXIMO - 1 : (uint64_t) x;
+    }
+    break;
+  }
+
+  case ADVERSARIO:
+    if (adversario.size() != (size_t) num_elem)
+      generar_adversario(num_elem);
+    std::copy(adversario.begin(), adversario.end(), claves);
+    break;
+
+  default:
+    break;
+  }
+}
+
+
+void Generador::preparar_zipf(Indice num_elem)
+{
+  if (acumulada.size() == (size_t) num_elem)
+    return;
+
+  // P(k) proporcional a 1 / (k + 1)^s, k = 0 .. num_elem - 1
+  double s = distribucion.parametro > 0 ? distribucion.parametro : 1;
+  acumulada.resize(num_elem);
+  double suma = 0;
+  for (Indice k = 0; k < num_elem; k++) {
+    suma += 1 / pow(k + 1, s);
+    acumulada[k] = suma;
+  }
+  for (Indice k = 0; k < num_elem; k++)
+    acumulada[k] /= suma;
+  acumulada[num_elem - 1] = 1;
+}
+
+
+/**
+   @brief Estado del adversario de McIlroy ("A killer adversary for
+   quicksort", 1999).
+
+   Los valores empiezan todos como "gas" (sin decidir). Al comparar dos
+   elementos de gas se congela uno, el que probablemente sea el pivote,
+   con el menor valor sólido aún libre; así cada partición deja el
+   pivote en un extremo.
+*/
+struct EstadoAdversario {
+  std::vector<Indice> valor;
+  Indice gas;
+  Indice solidos;
+  Indice candidato;
+};
+
+
+/**
+   @brief Comparador que decide los valores durante la ordenación.
+*/
+struct ComparadorAdversario {
+  EstadoAdversario * e;
+
+  bool operator()(Indice x, Indice y) const
+  {
+    std::vector<Indice> & v = e->valor;
+    if (v[x] == e->gas && v[y] == e->gas) {
+      if (x == e->candidato)
+        v[x] = e->solidos++;
+      else
+        v[y] = e->solidos++;
+    }
+    if (v[x] == e->gas)
+      e->candidato = x;
+    else if (v[y] == e->gas)
+      e->candidato = y;
+    return v[x] < v[y];
+  }
+};
+
+
+void Generador::generar_adversario(Indice num_elem)
+{
+  EstadoAdversario e;
+  e.gas = num_elem;
+  e.solidos = 0;
+  e.candidato = -1;
+  e.valor.assign(num_elem, e.gas);
+
+  std::vector<Indice> indices(num_elem);
+  for (Indice i = 0; i < num_elem; i++)
+    indices[i] = i;
+  ComparadorAdversario comp = { &e };
+  quicksort_robusto(&indices[0], num_elem, comp);
+
+  // Los que siguen siendo gas quedan iguales entre sí y mayores que el resto
+  adversario.assign(e.valor.begin(), e.valor.end());
+}
@@ -0,0 +1,137 @@
+/**
+   @file generador.h
+   @brief Generación reproducible de vectores de entrada con varias distribuciones.
+   @date 2026-10-17
+*/
+
+#ifndef GENERADOR_H
+#define GENERADOR_H
+
+#include "tipos.h"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+
+/**
+   @brief Forma de los vectores de entrada.
+*/
+enum TipoDistribucion {
+  UNIFORME,         ///< Claves aleatorias uniformes en [0, 2^31).
+  ORDENADO,         ///< Claves 0, 1, ..., n - 1.
+  INVERSO,          ///< Claves n - 1, ..., 1, 0.
+  CASI_ORDENADO,    ///< Ordenado con k intercambios aleatorios (n/100).
+  POCOS_VALORES,    ///< Uniforme entre k valores distintos (16).
+  ORGANO,           ///< Creciente hasta la mitad y decreciente después.
+  SIERRA,           ///< k tramos crecientes consecutivos (16).
+  ZIPF,             ///< Rango de Zipf de exponente s (1) entre n valores.
+  GAUSSIANA,        ///< Normal centrada en 2^30 con desviación 2^28.
+  ADVERSARIO,       ///< Entrada adversaria de McIlroy para quicksort_robusto.
+  NUM_DISTRIBUCIONES
+};
+
+
+/**
+   @brief Distribución de entrada y su parámetro.
+
+   El significado del parámetro depende de la distribución (número de
+   intercambios, de valores, de tramos o exponente); 0 indica el valor
+   por defecto, entre paréntesis en TipoDistribucion.
+*/
+struct Distribucion {
+  TipoDistribucion tipo;
+  double parametro;
+};
+
+
+/**
+   @brief Generador de vectores de entrada reproducible.
+
+   Las claves se obtienen de un mt19937_64 con la semilla dada, de modo
+   que dos ejecuciones con la misma semilla, distribución y tamaño
+   miden los mismos vectores. La entrada adversaria no depende de la
+   semilla: se construye una vez por tamaño y se reutiliza.
+*/
+class Generador {
+public:
+  Generador(const Distribucion & d, uint64_t semilla);
+
+  /**
+     @brief Vuelve a empezar la secuencia con la semilla dada.
+  */
+  void reiniciar(uint64_t semilla) { motor.seed(semilla); }
+
+  /**
+     @brief Genera num_elem claves enteras en [0, 2^31).
+     @param claves: vector de num_elem claves. Es MODIFICADO.
+  */
+  void generar(uint64_t claves[], Indice num_elem);
+
+  /**
+     @brief Rellena T con num_elem elementos de la distribución.
+     @param T: vector de num_elem elementos. Es MODIFICADO.
+  */
+  template <class Tipo>
+  void rellenar(Tipo T[], Indice num_elem);
+
+  /**
+     @brief Nombre de la distribución con su parámetro si no es el de por defecto.
+  */
+  std::string descripcion() const;
+
+  static const char * nombre(TipoDistribucion d);
+
+  /**
+     @brief Interpreta una distribución con formato nombre[:parametro].
+     @return false si el nombre o el parámetro no son válidos.
+  */
+  static bool leer(const std::string & texto, Distribucion & d);
+
+private:
+  Distribucion distribucion;
+  std::mt19937_64 motor;
+  std::vector<uint64_t> claves;
+  std::vector<uint64_t> adversario;
+  std::vector<double> acumulada;    ///< Función de distribución de Zipf.
+
+  void generar_adversario(Indice num_elem);
+  void preparar_zipf(Indice num_elem);
+};
+
+
+/**
+   @brief Convierte la clave de la posición i al tipo de elemento.
+
+   Los registros llevan como carga su posición original, lo que permite
+   comprobar la estabilidad de la ordenación.
+*/
+inline void asignar(float & x, uint64_t clave, Indice)    { x = clave; }
+inline void asignar(double & x, uint64_t clave, Indice)   { x = clave; }
+inline void asignar(uint32_t & x, uint64_t clave, Indice) { x = clave; }
+inline void asignar(uint64_t & x, uint64_t clave, Indice) { x = clave << 32 | clave; }
+inline void asignar(Registro & x, uint64_t clave, Indice i)
+{
+  x.clave = clave;
+  x.carga = i;
+}
+
+
+/**
+   Implementación de las funciones
+**/
+
+
+template <class Tipo>
+void Generador::rellenar(Tipo T[], Indice num_elem)
+{
+  if (claves.size() < (size_t) num_elem)
+    claves.resize(num_elem);
+  generar(&claves[0], num_elem);
+  for (Indice i = 0; i < num_elem; i++)
+    asignar(T[i], claves[i], i);
+}
+
+
+#endif
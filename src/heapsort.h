@@ -0,0 +1,231 @@
+/**
+   @file heapsort.h
+   @brief Ordenación por montones
+   @date 2023-3-6
+*/
+
+#ifndef HEAPSORT_H
+#define HEAPSORT_H
+
+#include "insercion.h"
+
+#include <functional>
+#include <cstdint>
+
+
+/* ************************************************************ */
+/*  Método de ordenación por montones  */
+
+/**
+   @brief Ordena un vector por el método de montones.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   Cambia el orden de los elementos de T de forma que los dispone
+   en sentido creciente de menor a mayor según comp.
+   Aplica el algoritmo de ordenación por montones.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+inline void heapsort(Tipo T[], Indice num_elem, Comparador comp = Comparador());
+
+
+
+/**
+   @brief Reajusta parte de un vector para que sea un montón.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param k: índice del elemento que se toma com raíz
+   @param comp: orden estricto entre elementos.
+
+   Reajusta los elementos entre las posiciones k y num_elem - 1
+   de T para que cumpla la propiedad de un montón (APO),
+   considerando al elemento en la posición k como la raíz.
+*/
+template <class Tipo, class Comparador>
+inline void reajustar(Tipo T[], Indice num_elem, Indice k, Comparador comp);
+
+
+/**
+   @brief Ordena un vector por montones de Aridad hijos por nodo.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   Cambia el orden de los elementos de T de forma que los dispone
+   en sentido creciente de menor a mayor según comp.
+   Los hijos del nodo k son Aridad * k + 1, ..., Aridad * k + Aridad y
+   el montón empieza en la posición en que cada grupo de hermanos ocupa
+   una sola línea de caché; los elementos anteriores, menos de Aridad,
+   se llevan los menores del vector y se ordenan por inserción. Reajusta
+   con reajustar_ascendente, de modo que cada nivel cuesta un acceso a
+   memoria y Aridad - 1 comparaciones.
+*/
+template <int Aridad, class Tipo, class Comparador = std::less<Tipo> >
+void heapsort_dario(Tipo T[], Indice num_elem, Comparador comp = Comparador());
+
+
+/**
+   @brief Reajusta un montón de Aridad hijos por nodo desde k (Floyd).
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param k: índice del elemento que se toma como raíz.
+   @param comp: orden estricto entre elementos.
+
+   Como reajustar, pero baja hasta una hoja subiendo en cada nivel el
+   mayor de los hijos, sin comparar con el elemento de la raíz, y luego
+   sube desde la hoja hasta encontrar su sitio. Como la raíz suele
+   acabar cerca de las hojas, hace casi la mitad de comparaciones.
+*/
+template <int Aridad, class Tipo, class Comparador>
+inline void reajustar_ascendente(Tipo T[], Indice num_elem, Indice k,
+                                 Comparador comp);
+
+
+
+
+/**
+   Implementación de las funciones
+**/
+
+
+template <class Tipo, class Comparador>
+inline void heapsort(Tipo T[], Indice num_elem, Comparador comp)
+{
+  Indice i;
+  for (i = num_elem/2 - 1; i >= 0; i--)
+    reajustar(T, num_elem, i, comp);
+  for (i = num_elem - 1; i >= 1; i--)
+    {
+      Tipo aux = T[0];
+      T[0] = T[i];
+      T[i] = aux;
+      reajustar(T, i, 0, comp);
+    }
+}
+
+
+template <class Tipo, class Comparador>
+inline void reajustar(Tipo T[], Indice num_elem, Indice k, Comparador comp)
+{
+  Indice j;
+  Tipo v;
+  v = T[k];
+  bool esAPO = false;
+  while ((k < num_elem/2) && !esAPO)
+    {
+      j = k + k + 1;
+      if ((j < (num_elem - 1)) && comp(T[j], T[j+1]))
+	j++;
+      if (!comp(v, T[j])){
+	esAPO = true;
+      }else{
+      T[k] = T[j];
+      k = j;
+      }
+    }
+  T[k] = v;
+}
+
+
+/**
+   @brief Posición desde la que los grupos de hermanos quedan alineados.
+
+   Con el montón en T + s, los hijos de cada nodo empiezan en una
+   posición de la forma Aridad * k + 1, así que s es el menor desplazamiento
+   que alinea T + s + 1 al tamaño de un grupo. Si el grupo no divide una
+   línea de caché de 64 bytes no hay alineación posible y s es 0.
+*/
+template <int Aridad, class Tipo>
+inline Indice inicio_monton(const Tipo T[])
+{
+  const uintptr_t grupo = Aridad * sizeof(Tipo);
+  uintptr_t d = reinterpret_cast<uintptr_t>(T + 1);
+  if (64 % grupo != 0 || d % sizeof(Tipo) != 0)
+    return 0;
+  return (grupo - d % grupo) % grupo / sizeof(Tipo);
+}
+
+
+template <int Aridad, class Tipo, class Comparador>
+void heapsort_dario(Tipo T[], Indice num_elem, Comparador comp)
+{
+  if (num_elem <= 1)
+    return;
+  Indice s = inicio_monton<Aridad>(T);
+  if (s >= num_elem)
+    s = 0;
+
+  // Los s menores van al principio, fuera del montón
+  Indice i, j;
+  if (s > 0) {
+    Indice m = 0;
+    for (j = 1; j < s; j++)
+      if (comp(T[m], T[j]))
+        m = j;
+    for (i = s; i < num_elem; i++)
+      if (comp(T[i], T[m])) {
+        Tipo aux = T[i];
+        T[i] = T[m];
+        T[m] = aux;
+        m = 0;
+        for (j = 1; j < s; j++)
+          if (comp(T[m], T[j]))
+            m = j;
+      }
+    insercion_lims(T, 0, s, comp);
+  }
+
+  Tipo * M = T + s;
+  Indice n = num_elem - s;
+  for (i = (n - 2) / Aridad; i >= 0; i--)
+    reajustar_ascendente<Aridad>(M, n, i, comp);
+  for (i = n - 1; i >= 1; i--) {
+    Tipo aux = M[0];
+    M[0] = M[i];
+    M[i] = aux;
+    reajustar_ascendente<Aridad>(M, i, 0, comp);
+  }
+}
+
+
+template <int Aridad, class Tipo, class Comparador>
+inline void reajustar_ascendente(Tipo T[], Indice num_elem, Indice k,
+                                 Comparador comp)
+{
+  const Indice raiz = k;
+  Tipo v = T[k];
+  Indice c;
+
+  // Bajada: el mayor de los hijos sube al hueco
+  while ((c = Aridad * k + 1) < num_elem) {
+    Indice fin = c + Aridad < num_elem ? c + Aridad : num_elem;
+    Indice mayor = c;
+    for (Indice j = c + 1; j < fin; j++)
+      if (comp(T[mayor], T[j]))
+        mayor = j;
+    T[k] = T[mayor];
+    k = mayor;
+  }
+
+  // Subida: v vuelve hacia la raíz hasta encontrar un padre no menor
+  while (k > raiz) {
+    Indice p = (k - 1) / Aridad;
+    if (!comp(T[p], v))
+      break;
+    T[k] = T[p];
+    k = p;
+  }
+  T[k] = v;
+}
+
+
+#endif
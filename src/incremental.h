@@ -0,0 +1,304 @@
+/**
+   @file incremental.h
+   @brief Vectores ordenados que absorben lotes de elementos nuevos sin
+   volver a ordenarse enteros.
+   @date 2026-10-17
+*/
+
+#ifndef INCREMENTAL_H
+#define INCREMENTAL_H
+
+#include "mergesort_natural.h"
+#include "quicksort.h"
+
+#include <functional>
+#include <algorithm>
+#include <vector>
+
+
+/* ************************************************************ */
+/*  Ordenación incremental  */
+
+/**
+   @brief Vector ordenado al que se añaden lotes.
+
+   Cada lote se copia al final, se ordena solo y se mezcla con el resto
+   con fusion_galope. Las búsquedas exponenciales de la mezcla descartan
+   sin moverlos los elementos del principio que ya están en su sitio y
+   copian de una vez los bloques del vector entre dos elementos
+   consecutivos del lote, así que un lote de m elementos sobre n cuesta
+   O(m log(n / m)) comparaciones más la copia de los elementos que
+   desplaza. Si el lote cae al final (claves crecientes, como marcas de
+   tiempo) no desplaza ninguno.
+
+   Ante elementos equivalentes, los ya insertados van delante de los del
+   lote.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+class VectorOrdenado {
+public:
+  /**
+     @param ordenar: ordenación de cada lote. Si es NULL, quicksort_robusto
+                     con comp.
+     @param comp: orden estricto entre elementos.
+  */
+  explicit VectorOrdenado(void (*ordenar)(Tipo T[], Indice num_elem) = NULL,
+                          Comparador comp = Comparador());
+
+  /**
+     @brief Sustituye el contenido por los num_elem elementos de T, que
+     se ordenan.
+  */
+  void asignar(const Tipo T[], Indice num_elem);
+
+  /**
+     @brief Añade los num_elem elementos de lote. num_elem >= 0.
+  */
+  void insertar(const Tipo lote[], Indice num_elem);
+
+  /**
+     @brief Reserva espacio para capacidad elementos, de modo que los
+     lotes siguientes no tengan que copiar el vector al crecer.
+  */
+  void reservar(Indice capacidad) { datos.reserve(capacidad); }
+
+  Indice num_elem() const { return datos.size(); }
+
+  /**
+     @brief Los elementos, en sentido creciente según comp.
+  */
+  const Tipo * elementos() const { return datos.data(); }
+
+private:
+  std::vector<Tipo> datos;
+  std::vector<Tipo> aux;
+  void (*ordenar)(Tipo T[], Indice num_elem);
+  Comparador comp;
+};
+
+
+/**
+   @brief Conjunto ordenado por niveles (log-structured) al que se añaden
+   lotes.
+
+   Guarda los elementos en niveles ordenados, del más antiguo al más
+   reciente, cada uno con al menos FACTOR_NIVELES veces los elementos del
+   siguiente. Cada lote ordenado es un nivel nuevo; mientras el anterior
+   no sea FACTOR_NIVELES veces mayor se mezclan los dos con
+   fusion_galope. Así sólo se mezclan niveles de tamaño parecido, cada
+   elemento pasa por O(log(n / m)) mezclas y un lote de m elementos
+   cuesta O(m log(n / m)) amortizado, sin copias de todo el conjunto
+   salvo cuando lo acumulado en los niveles recientes alcanza la mitad
+   del más antiguo. Hay O(log(n / m)) niveles, y las consultas buscan en
+   todos; compactar los mezcla en uno.
+
+   Ante elementos equivalentes, los más antiguos van delante.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+class NivelesOrdenados {
+public:
+  /**
+     @param ordenar: ordenación de cada lote. Si es NULL, quicksort_robusto
+                     con comp.
+     @param comp: orden estricto entre elementos.
+  */
+  explicit NivelesOrdenados(void (*ordenar)(Tipo T[], Indice num_elem) = NULL,
+                            Comparador comp = Comparador());
+
+  /**
+     @brief Sustituye el contenido por los num_elem elementos de T, que
+     se ordenan en un único nivel.
+  */
+  void asignar(const Tipo T[], Indice num_elem);
+
+  /**
+     @brief Añade los num_elem elementos de lote. num_elem >= 0.
+  */
+  void insertar(const Tipo lote[], Indice num_elem);
+
+  /**
+     @brief Mezcla todos los niveles en uno.
+  */
+  void compactar();
+
+  Indice num_elem() const { return total; }
+
+  int num_niveles() const { return niveles.size(); }
+
+  /**
+     @brief Los elementos del nivel i, del más antiguo (0) al más
+     reciente, en sentido creciente según comp.
+  */
+  const std::vector<Tipo> & nivel(int i) const { return niveles[i]; }
+
+  /**
+     @brief Número de elementos menores que x.
+  */
+  Indice contar_menores(const Tipo & x) const;
+
+  bool contiene(const Tipo & x) const;
+
+private:
+  /**
+     @brief Mezcla los dos niveles más recientes.
+  */
+  void fusionar_ultimos();
+
+  std::vector<std::vector<Tipo> > niveles;
+  std::vector<Tipo> aux;
+  Indice total;
+  void (*ordenar)(Tipo T[], Indice num_elem);
+  Comparador comp;
+};
+
+
+
+/**
+   Implementación de las funciones
+**/
+
+
+/**
+   Proporción mínima entre los tamaños de dos niveles consecutivos.
+**/
+const int FACTOR_NIVELES = 2;
+
+
+/**
+   @brief Ordena un lote con ordenar o, si es NULL, con quicksort_robusto.
+*/
+template <class Tipo, class Comparador>
+inline void ordenar_lote(Tipo T[], Indice num_elem,
+                         void (*ordenar)(Tipo T[], Indice num_elem),
+                         Comparador comp)
+{
+  if (num_elem <= 1)
+    return;
+  if (ordenar)
+    ordenar(T, num_elem);
+  else
+    quicksort_robusto(T, num_elem, comp);
+}
+
+
+/**
+   @brief Mezcla el tramo ordenado [n, V.size()) del final de V con el
+   tramo ordenado [0, n).
+*/
+template <class Tipo, class Comparador>
+inline void fusionar_final(std::vector<Tipo> & V, Indice n, std::vector<Tipo> & aux,
+                           Comparador comp)
+{
+  Indice m = V.size() - n;
+  if (n == 0 || m == 0)
+    return;
+  if ((Indice) aux.size() < std::min(n, m))
+    aux.resize(std::min(n, m));
+  fusion_galope(V.data(), 0, n, n + m, aux.data(), comp);
+}
+
+
+template <class Tipo, class Comparador>
+VectorOrdenado<Tipo, Comparador>::VectorOrdenado(
+    void (*ordenar)(Tipo T[], Indice num_elem), Comparador comp)
+  : ordenar(ordenar), comp(comp)
+{
+}
+
+
+template <class Tipo, class Comparador>
+void VectorOrdenado<Tipo, Comparador>::asignar(const Tipo T[], Indice num_elem)
+{
+  datos.assign(T, T + num_elem);
+  ordenar_lote(datos.data(), num_elem, ordenar, comp);
+}
+
+
+template <class Tipo, class Comparador>
+void VectorOrdenado<Tipo, Comparador>::insertar(const Tipo lote[], Indice num_elem)
+{
+  Indice n = datos.size();
+  datos.insert(datos.end(), lote, lote + num_elem);
+  ordenar_lote(datos.data() + n, num_elem, ordenar, comp);
+  fusionar_final(datos, n, aux, comp);
+}
+
+
+template <class Tipo, class Comparador>
+NivelesOrdenados<Tipo, Comparador>::NivelesOrdenados(
+    void (*ordenar)(Tipo T[], Indice num_elem), Comparador comp)
+  : total(0), ordenar(ordenar), comp(comp)
+{
+}
+
+
+template <class Tipo, class Comparador>
+void NivelesOrdenados<Tipo, Comparador>::asignar(const Tipo T[], Indice num_elem)
+{
+  niveles.clear();
+  total = 0;
+  insertar(T, num_elem);
+}
+
+
+template <class Tipo, class Comparador>
+void NivelesOrdenados<Tipo, Comparador>::insertar(const Tipo lote[], Indice num_elem)
+{
+  if (num_elem <= 0)
+    return;
+  niveles.push_back(std::vector<Tipo>(lote, lote + num_elem));
+  ordenar_lote(niveles.back().data(), num_elem, ordenar, comp);
+  total += num_elem;
+
+  size_t s;
+  while ((s = niveles.size()) >= 2 &&
+         niveles[s - 2].size() < FACTOR_NIVELES * niveles[s - 1].size())
+    fusionar_ultimos();
+}
+
+
+template <class Tipo, class Comparador>
+void NivelesOrdenados<Tipo, Comparador>::fusionar_ultimos()
+{
+  std::vector<Tipo> & anterior = niveles[niveles.size() - 2];
+  std::vector<Tipo> & ultimo = niveles.back();
+  Indice n = anterior.size();
+  anterior.insert(anterior.end(), ultimo.begin(), ultimo.end());
+  niveles.pop_back();
+  fusionar_final(anterior, n, aux, comp);
+}
+
+
+template <class Tipo, class Comparador>
+void NivelesOrdenados<Tipo, Comparador>::compactar()
+{
+  while (niveles.size() >= 2)
+    fusionar_ultimos();
+}
+
+
+template <class Tipo, class Comparador>
+Indice NivelesOrdenados<Tipo, Comparador>::contar_menores(const Tipo & x) const
+{
+  Indice menores = 0;
+  for (size_t i = 0; i < niveles.size(); i++)
+    menores += std::lower_bound(niveles[i].begin(), niveles[i].end(), x, comp)
+               - niveles[i].begin();
+  return menores;
+}
+
+
+template <class Tipo, class Comparador>
+bool NivelesOrdenados<Tipo, Comparador>::contiene(const Tipo & x) const
+{
+  for (size_t i = 0; i < niveles.size(); i++) {
+    typename std::vector<Tipo>::const_iterator p =
+      std::lower_bound(niveles[i].begin(), niveles[i].end(), x, comp);
+    if (p != niveles[i].end() && !comp(x, *p))
+      return true;
+  }
+  return false;
+}
+
+
+#endif
@@ -0,0 +1,247 @@
+/**
+   @file indices.h
+   @brief Ordenación de registros por índices: pares (clave, índice) de 64 bits.
+   @date 2026-10-17
+*/
+
+#ifndef INDICES_H
+#define INDICES_H
+
+#include "arena.h"
+#include "radix.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+   @brief Clave de un registro junto a su posición, en una palabra de 64 bits.
+
+   Los 32 bits altos son la clave traducida con ClaveRadix, que conserva
+   el orden, y los 32 bajos la posición del registro. Ordenar los pares
+   con operator< los deja en el orden de las claves y, a igual clave, en
+   el de las posiciones, así que cualquier algoritmo da un orden estable.
+   Por eso no se pueden ordenar más de MAX_ELEM_INDICES registros.
+*/
+struct ClaveIndice {
+  uint64_t v;
+
+  uint32_t indice() const { return (uint32_t) v; }
+};
+
+inline bool operator<(const ClaveIndice & a, const ClaveIndice & b)
+{
+  return a.v < b.v;
+}
+
+
+/**
+   radix sólo reparte por la mitad de la clave: los pares se crean en
+   orden de posición y radix es estable, así que los empates ya quedan
+   ordenados por índice. Son tres pasadas en lugar de las ocho de una
+   clave de 64 bits.
+**/
+template <>
+struct ClaveRadix<ClaveIndice> {
+  typedef uint32_t Clave;
+  static const int BITS = 11;
+  static Clave clave(const ClaveIndice & x) { return x.v >> 32; }
+};
+
+
+/**
+   Mayor número de elementos que se ordenan por índices: los índices
+   son de 32 bits.
+**/
+const Indice MAX_ELEM_INDICES = (Indice) 1 << 32;
+
+
+/**
+   Elementos por delante a los que se anticipa la lectura al reunir.
+**/
+const int DISTANCIA_REUNIR = 16;
+
+
+/* ************************************************************ */
+/*  Ordenación por índices  */
+
+/**
+   @brief Crea los pares (clave, índice) de un vector de registros.
+
+   @param R: vector de registros. Debe tener num_elem elementos.
+   @param num_elem: número de elementos.
+                   0 < num_elem <= MAX_ELEM_INDICES.
+   @param P: vector de num_elem pares. Es MODIFICADO.
+   @param clave: objeto función que da la clave de un registro. La clave
+                 debe ser de un tipo con ClaveRadix de 32 bits (float o
+                 uint32_t).
+
+   P[i] lleva la clave de R[i] y el índice i.
+*/
+template <class Tipo, class Extractor>
+void pares_clave_indice(const Tipo R[], Indice num_elem, ClaveIndice P[],
+                        Extractor clave);
+
+
+/**
+   @brief Calcula la permutación que ordena un vector de registros (argsort).
+
+   @param R: vector de registros. Debe tener num_elem elementos.
+   @param num_elem: número de elementos.
+                   0 < num_elem <= MAX_ELEM_INDICES.
+   @param perm: vector de num_elem índices. Es MODIFICADO.
+   @param clave: objeto función que da la clave de un registro (ver
+                 pares_clave_indice).
+   @param ordenar: ordenación de los pares, llamada como
+                   ordenar(P, num_elem). Por defecto, radix.
+
+   Deja en perm[i] la posición en R del registro que va el i-ésimo en
+   orden creciente de clave. R no cambia. Los registros no se mueven:
+   sólo se ordenan pares de 8 bytes, así que el coste de la ordenación
+   no depende del tamaño de los registros. Es estable.
+*/
+template <class Tipo, class Extractor, class Ordenacion>
+void argsort(const Tipo R[], Indice num_elem, uint32_t perm[], Extractor clave,
+             Ordenacion ordenar);
+
+template <class Tipo, class Extractor>
+void argsort(const Tipo R[], Indice num_elem, uint32_t perm[], Extractor clave);
+
+
+/**
+   @brief Aplica una permutación a un vector de registros.
+
+   @param origen: vector de registros. Debe tener num_elem elementos.
+   @param destino: vector de num_elem registros, distinto de origen.
+                   Es MODIFICADO.
+   @param perm: permutación de 0, ..., num_elem - 1.
+   @param num_elem: número de elementos. num_elem <= MAX_ELEM_INDICES.
+
+   destino[i] = origen[perm[i]]. destino se escribe en orden y las
+   lecturas de origen, que saltan por todo el vector, se anticipan
+   DISTANCIA_REUNIR elementos con __builtin_prefetch, de modo que varios
+   fallos de caché están en curso a la vez en lugar de uno tras otro.
+*/
+template <class Tipo>
+void reunir(const Tipo origen[], Tipo destino[], const uint32_t perm[],
+            Indice num_elem);
+
+
+/**
+   @brief Ordena un vector de registros por su clave moviendo cada uno una vez.
+
+   @param T: vector de registros. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos.
+                   0 < num_elem <= MAX_ELEM_INDICES.
+   @param clave: objeto función que da la clave de un registro (ver
+                 pares_clave_indice).
+   @param ordenar: ordenación de los pares (ver argsort).
+   @param aux: vector auxiliar de num_elem registros o NULL. Si es NULL
+               se reserva uno. Es MODIFICADO.
+
+   Ordena los pares (clave, índice), reúne los registros en aux en ese
+   orden y los copia de vuelta a T. Frente a ordenar los registros
+   directamente, cambia O(n log n) movimientos de registros completos
+   por dos pasadas sobre ellos. Es estable.
+*/
+template <class Tipo, class Extractor, class Ordenacion>
+void ordenar_por_clave(Tipo T[], Indice num_elem, Extractor clave,
+                       Ordenacion ordenar, Tipo aux[] = NULL);
+
+
+
+/**
+   Implementación de las funciones
+**/
+
+
+template <class Tipo, class Extractor>
+void pares_clave_indice(const Tipo R[], Indice num_elem, ClaveIndice P[],
+                        Extractor clave)
+{
+  assert(num_elem <= MAX_ELEM_INDICES);
+  for (Indice i = 0; i < num_elem; i++) {
+    auto k = clave(R[i]);
+    typedef ClaveRadix<decltype(k)> Traduccion;
+    static_assert(sizeof(typename Traduccion::Clave) == 4,
+                  "la clave debe traducirse a 32 bits");
+    P[i].v = ((uint64_t) Traduccion::clave(k) << 32) | (uint32_t) i;
+  }
+}
+
+
+/**
+   @brief Ordena pares con radix. Ordenación por defecto de argsort.
+*/
+struct RadixPares {
+  void operator()(ClaveIndice P[], Indice num_elem) const { radix(P, num_elem); }
+};
+
+
+template <class Tipo, class Extractor, class Ordenacion>
+void argsort(const Tipo R[], Indice num_elem, uint32_t perm[], Extractor clave,
+             Ordenacion ordenar)
+{
+  ClaveIndice * P = reservar_auxiliar<ClaveIndice>(num_elem);
+  pares_clave_indice(R, num_elem, P, clave);
+  ordenar(P, num_elem);
+  for (Indice i = 0; i < num_elem; i++)
+    perm[i] = P[i].indice();
+  liberar_auxiliar(P);
+}
+
+
+template <class Tipo, class Extractor>
+void argsort(const Tipo R[], Indice num_elem, uint32_t perm[], Extractor clave)
+{
+  argsort(R, num_elem, perm, clave, RadixPares());
+}
+
+
+template <class Tipo>
+void reunir(const Tipo origen[], Tipo destino[], const uint32_t perm[],
+            Indice num_elem)
+{
+  assert(num_elem <= MAX_ELEM_INDICES);
+  Indice i;
+  Indice sin_anticipar = std::max<Indice>(num_elem - DISTANCIA_REUNIR, 0);
+  for (i = 0; i < sin_anticipar; i++) {
+    __builtin_prefetch(origen + perm[i + DISTANCIA_REUNIR]);
+    destino[i] = origen[perm[i]];
+  }
+  for (; i < num_elem; i++)
+    destino[i] = origen[perm[i]];
+}
+
+
+template <class Tipo, class Extractor, class Ordenacion>
+void ordenar_por_clave(Tipo T[], Indice num_elem, Extractor clave,
+                       Ordenacion ordenar, Tipo aux[])
+{
+  Tipo * propio = aux ? NULL : reservar_auxiliar<Tipo>(num_elem);
+  Tipo * destino = aux ? aux : propio;
+  ClaveIndice * P = reservar_auxiliar<ClaveIndice>(num_elem);
+
+  pares_clave_indice(T, num_elem, P, clave);
+  ordenar(P, num_elem);
+
+  // Como reunir, leyendo los índices de los propios pares
+  Indice i;
+  Indice sin_anticipar = std::max<Indice>(num_elem - DISTANCIA_REUNIR, 0);
+  for (i = 0; i < sin_anticipar; i++) {
+    __builtin_prefetch(T + P[i + DISTANCIA_REUNIR].indice());
+    destino[i] = T[P[i].indice()];
+  }
+  for (; i < num_elem; i++)
+    destino[i] = T[P[i].indice()];
+  std::copy(destino, destino + num_elem, T);
+
+  liberar_auxiliar(P);
+  liberar_auxiliar(propio);
+}
+
+
+#endif
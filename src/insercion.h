@@ -0,0 +1,85 @@
+/**
+   @file insercion.h
+   @brief Ordenación por inserción
+   @date 2023-3-6
+*/
+
+#ifndef INSERCION_H
+#define INSERCION_H
+
+#include "tipos.h"
+
+#include <functional>
+
+
+/* ************************************************************ */
+/*  Método de ordenación por inserción  */
+
+/**
+   @brief Ordena un vector por el método de inserción.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   Cambia el orden de los elementos de T de forma que los dispone
+   en sentido creciente de menor a mayor según comp.
+   Aplica el algoritmo de inserción.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+inline void insercion(Tipo T[], Indice num_elem, Comparador comp = Comparador());
+
+
+
+/**
+   @brief Ordena parte de un vector por el método de inserción.
+
+   @param T: vector de elementos. Tiene un número de elementos
+                   mayor o igual a final. Es MODIFICADO.
+   @param inicial: Posición que marca el incio de la parte del
+                   vector a ordenar.
+   @param final: Posición detrás de la última de la parte del
+                   vector a ordenar.
+		   inicial < final.
+   @param comp: orden estricto entre elementos.
+
+   Cambia el orden de los elementos de T entre las posiciones
+   inicial y final - 1 de forma que los dispone en sentido creciente
+   de menor a mayor según comp.
+   Aplica el algoritmo de inserción.
+*/
+template <class Tipo, class Comparador>
+inline void insercion_lims(Tipo T[], Indice inicial, Indice final, Comparador comp);
+
+
+
+/**
+   Implementación de las funciones
+**/
+
+template <class Tipo, class Comparador>
+inline void insercion(Tipo T[], Indice num_elem, Comparador comp)
+{
+  insercion_lims(T, 0, num_elem, comp);
+}
+
+
+template <class Tipo, class Comparador>
+inline void insercion_lims(Tipo T[], Indice inicial, Indice final, Comparador comp)
+{
+  Indice i, j;
+  Tipo aux;
+  for (i = inicial + 1; i < final; i++) {
+    j = i;
+    while ((j > inicial) && comp(T[j], T[j-1])) {
+      aux = T[j];
+      T[j] = T[j-1];
+      T[j-1] = aux;
+      j--;
+    };
+  };
+}
+
+
+#endif
@@ -0,0 +1,239 @@
+/**
+   @file medicion.cpp
+   @brief Motor de medición de tiempos con calentamiento y estadísticos robustos.
+   @date 2026-10-17
+*/
+
+
+#include "medicion.h"
+#include "contadores.h"
+#include "perfil_memoria.h"
+
+#include <algorithm>
+#include <vector>
+#include <fstream>
+#include <string>
+#include <random>
+#include <chrono>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAY_TSC 1
+#else
+#define HAY_TSC 0
+#endif
+
+using std::vector;
+using namespace std::chrono;
+
+
+/* ************************************************************ */
+/*  Reloj  */
+
+/**
+   @brief Comprueba que el TSC avanza a ritmo constante en todos los estados.
+*/
+static bool tsc_invariante()
+{
+#if HAY_TSC
+  std::ifstream f("/proc/cpuinfo");
+  std::string linea;
+  while (getline(f, linea))
+    if (linea.compare(0, 5, "flags") == 0)
+      return linea.find(" constant_tsc") != std::string::npos &&
+             linea.find(" nonstop_tsc") != std::string::npos;
+#endif
+  return false;
+}
+
+
+/**
+   @brief Segundos por ciclo del TSC, medidos contra steady_clock.
+*/
+static double calibrar_tsc()
+{
+#if HAY_TSC
+  const duration<double> intervalo(0.05);
+  steady_clock::time_point t0 = steady_clock::now();
+  uint64_t c0 = __rdtsc();
+  steady_clock::time_point t1;
+  do {
+    t1 = steady_clock::now();
+  } while (t1 - t0 < intervalo);
+  uint64_t c1 = __rdtsc();
+  return duration_cast<duration<double>>(t1 - t0).count() / (c1 - c0);
+#else
+  return 0.0;
+#endif
+}
+
+
+Reloj::Reloj(TipoReloj tipo)
+  : tipo_(tipo)
+{
+  if (tipo_ == RELOJ_TSC && !tsc_invariante())
+    tipo_ = RELOJ_STEADY;
+
+  if (tipo_ == RELOJ_TSC)
+    segundos_por_tick = calibrar_tsc();
+  else
+    segundos_por_tick = (double) steady_clock::period::num /
+                        steady_clock::period::den;
+}
+
+
+uint64_t Reloj::ahora() const
+{
+#if HAY_TSC
+  if (tipo_ == RELOJ_TSC) {
+    unsigned int aux;
+    return __rdtscp(&aux);
+  }
+#endif
+  return steady_clock::now().time_since_epoch().count();
+}
+
+
+const char * Reloj::nombre() const
+{
+  return tipo_ == RELOJ_TSC ? "tsc" : "steady_clock";
+}
+
+
+/* ************************************************************ */
+/*  Estadísticos  */
+
+/**
+   @brief Percentil p (entre 0 y 1) de un vector ordenado, interpolando.
+*/
+static double percentil(const vector<double> & ordenado, double p)
+{
+  double pos = p * (ordenado.size() - 1);
+  size_t i = (size_t) pos;
+  if (i + 1 >= ordenado.size())
+    return ordenado.back();
+  double frac = pos - i;
+  return ordenado[i] * (1 - frac) + ordenado[i + 1] * frac;
+}
+
+
+/**
+   @brief Intervalo de confianza de la mediana por bootstrap de percentiles.
+*/
+static void intervalo_mediana(const vector<double> & datos,
+                              const ConfigMedicion & config,
+                              double & inf, double & sup)
+{
+  std::mt19937 gen(12345);
+  std::uniform_int_distribution<size_t> indice(0, datos.size() - 1);
+  vector<double> medianas(config.remuestreos);
+  vector<double> remuestra(datos.size());
+
+  for (int b = 0; b < config.remuestreos; b++) {
+    for (size_t i = 0; i < remuestra.size(); i++)
+      remuestra[i] = datos[indice(gen)];
+    std::nth_element(remuestra.begin(), remuestra.begin() + remuestra.size() / 2,
+                     remuestra.end());
+    medianas[b] = remuestra[remuestra.size() / 2];
+  }
+
+  std::sort(medianas.begin(), medianas.end());
+  double alfa = 1 - config.confianza;
+  inf = percentil(medianas, alfa / 2);
+  sup = percentil(medianas, 1 - alfa / 2);
+}
+
+
+/**
+   @brief Calcula los estadísticos de las muestras descartando los atípicos.
+*/
+static Estadisticos resumir(vector<double> muestras, const ConfigMedicion & config)
+{
+  Estadisticos e;
+  std::sort(muestras.begin(), muestras.end());
+
+  double q1 = percentil(muestras, 0.25);
+  double q3 = percentil(muestras, 0.75);
+  double limite = q3 + 3 * (q3 - q1);
+  vector<double> validas;
+  for (size_t i = 0; i < muestras.size(); i++)
+    if (muestras[i] <= limite)
+      validas.push_back(muestras[i]);
+
+  e.muestras = muestras.size();
+  e.atipicos = muestras.size() - validas.size();
+  e.minimo = validas.front();
+  e.mediana = percentil(validas, 0.5);
+  e.p90 = percentil(validas, 0.90);
+  e.p99 = percentil(validas, 0.99);
+
+  double suma = 0;
+  for (size_t i = 0; i < validas.size(); i++)
+    suma += validas[i];
+  e.media = suma / validas.size();
+
+  double cuadrados = 0;
+  for (size_t i = 0; i < validas.size(); i++)
+    cuadrados += (validas[i] - e.media) * (validas[i] - e.media);
+  e.desviacion = validas.size() > 1 ? sqrt(cuadrados / (validas.size() - 1)) : 0;
+
+  intervalo_mediana(validas, config, e.ic_inf, e.ic_sup);
+
+  return e;
+}
+
+
+/* ************************************************************ */
+/*  Medición  */
+
+Estadisticos medir(const std::function<void()> & preparar,
+                   const std::function<void()> & ejecutar,
+                   const ConfigMedicion & config, const Reloj & reloj,
+                   ContadoresHW * contadores, PerfilMemoria * memoria)
+{
+  for (int i = 0; i < config.calentamiento; i++) {
+    preparar();
+    ejecutar();
+  }
+
+  if (contadores)
+    contadores->reiniciar();
+  if (memoria)
+    memoria->reiniciar();
+
+  vector<double> muestras;
+  double total = 0;
+  Estadisticos e;
+
+  while (true) {
+    preparar();
+    if (memoria)
+      memoria->iniciar();
+    if (contadores)
+      contadores->iniciar();
+    uint64_t t_antes = reloj.ahora();
+    ejecutar();
+    uint64_t t_despues = reloj.ahora();
+    if (contadores)
+      contadores->detener();
+    if (memoria)
+      memoria->detener();
+
+    double t = reloj.segundos(t_despues - t_antes);
+    muestras.push_back(t);
+    total += t;
+
+    if ((int) muestras.size() < config.muestras_min)
+      continue;
+
+    e = resumir(muestras, config);
+    double semiamplitud = (e.ic_sup - e.ic_inf) / 2;
+    if (semiamplitud <= config.precision * e.mediana ||
+        (int) muestras.size() >= config.muestras_max ||
+        total >= config.tiempo_max)
+      break;
+  }
+
+  return e;
+}
@@ -0,0 +1,122 @@
+/**
+   @file medicion.h
+   @brief Motor de medición de tiempos con calentamiento y estadísticos robustos.
+   @date 2026-10-17
+*/
+
+#ifndef MEDICION_H
+#define MEDICION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+class ContadoresHW;
+class PerfilMemoria;
+
+
+/**
+   @brief Fuente de tiempo usada en las mediciones.
+*/
+enum TipoReloj { RELOJ_STEADY, RELOJ_TSC };
+
+
+/**
+   @brief Reloj de medición.
+
+   Con RELOJ_STEADY lee std::chrono::steady_clock. Con RELOJ_TSC lee
+   el contador de ciclos del procesador, calibrado contra steady_clock
+   al construir el reloj. Si el TSC no es invariante (o la arquitectura
+   no lo tiene) se usa steady_clock.
+*/
+class Reloj {
+public:
+  explicit Reloj(TipoReloj tipo = RELOJ_STEADY);
+
+  /**
+     @brief Lectura actual en ticks del reloj.
+  */
+  uint64_t ahora() const;
+
+  /**
+     @brief Convierte una diferencia de ticks a segundos.
+  */
+  double segundos(uint64_t ticks) const { return ticks * segundos_por_tick; }
+
+  TipoReloj tipo() const { return tipo_; }
+
+  const char * nombre() const;
+
+private:
+  TipoReloj tipo_;
+  double segundos_por_tick;
+};
+
+
+/**
+   @brief Parámetros de una medición.
+*/
+struct ConfigMedicion {
+  int calentamiento;      ///< Ejecuciones previas que no se miden.
+  int muestras_min;       ///< Muestras que se toman siempre.
+  int muestras_max;       ///< Límite del remuestreo adaptativo.
+  double precision;       ///< Semiamplitud relativa del intervalo buscada.
+  double tiempo_max;      ///< Segundos a partir de los que no se remuestrea.
+  int remuestreos;        ///< Remuestreos bootstrap del intervalo.
+  double confianza;       ///< Nivel de confianza del intervalo.
+
+  ConfigMedicion()
+    : calentamiento(1), muestras_min(10), muestras_max(50), precision(0.02),
+      tiempo_max(10.0), remuestreos(1000), confianza(0.95) {}
+};
+
+
+/**
+   @brief Resumen estadístico de las muestras de una medición, en segundos.
+
+   Las muestras por encima de Q3 + 3 * RIC (ejecuciones interrumpidas por
+   el sistema) se cuentan en atipicos y no intervienen en el resto de
+   valores.
+*/
+struct Estadisticos {
+  int muestras;
+  int atipicos;
+  double minimo;
+  double mediana;
+  double p90;
+  double p99;
+  double media;
+  double desviacion;
+  double ic_inf;          ///< Extremo inferior del intervalo de la mediana.
+  double ic_sup;          ///< Extremo superior del intervalo de la mediana.
+};
+
+
+/**
+   @brief Mide una operación hasta que la mediana es suficientemente precisa.
+
+   @param preparar: se llama antes de cada ejecución, fuera de la medición
+                    (por ejemplo, para regenerar el vector desordenado).
+   @param ejecutar: operación medida.
+   @param config: parámetros de la medición.
+   @param reloj: reloj con el que se mide.
+   @param contadores: si no es NULL, cuenta los eventos hardware de
+                      cada muestra medida (no del calentamiento).
+                      Es MODIFICADO.
+   @param memoria: si no es NULL, perfila las reservas y los fallos de
+                   página de cada muestra medida. Es MODIFICADO.
+
+   Hace config.calentamiento ejecuciones sin medir y después toma al
+   menos config.muestras_min muestras. Mientras la semiamplitud del
+   intervalo de confianza bootstrap de la mediana supere
+   config.precision veces la mediana, sigue tomando muestras hasta
+   llegar a config.muestras_max o a config.tiempo_max segundos.
+*/
+Estadisticos medir(const std::function<void()> & preparar,
+                   const std::function<void()> & ejecutar,
+                   const ConfigMedicion & config, const Reloj & reloj,
+                   ContadoresHW * contadores = NULL,
+                   PerfilMemoria * memoria = NULL);
+
+
+#endif
@@ -0,0 +1,287 @@
+/**
+   @file mergesort.h
+   @brief Ordenación por mezcla
+   @date 2023-3-6
+*/
+
+#ifndef MERGESORT_H
+#define MERGESORT_H
+
+#include "arena.h"
+#include "insercion.h"
+#include "umbrales.h"
+
+#include <functional>
+#include <algorithm>
+#include <cstddef>
+#include <cassert>
+
+
+/* ************************************************************ */
+/*  Método de ordenación por mezcla  */
+
+/**
+   @brief Ordena un vector por el método de mezcla.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   Cambia el orden de los elementos de T de forma que los dispone
+   en sentido creciente de menor a mayor según comp.
+   Aplica el algoritmo de mezcla.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+inline void mergesort(Tipo T[], Indice num_elem, Comparador comp = Comparador());
+
+
+
+/**
+   @brief Ordena parte de un vector por el método de mezcla.
+
+   @param T: vector de elementos. Tiene un número de elementos
+                   mayor o igual a final. Es MODIFICADO.
+   @param inicial: Posición que marca el incio de la parte del
+                   vector a ordenar.
+   @param final: Posición detrás de la última de la parte del
+                   vector a ordenar.
+		   inicial < final.
+   @param comp: orden estricto entre elementos.
+
+   Cambia el orden de los elementos de T entre las posiciones
+   inicial y final - 1 de forma que los dispone en sentido creciente
+   de menor a mayor según comp.
+   Aplica el algoritmo de la mezcla.
+*/
+template <class Tipo, class Comparador>
+void mergesort_lims(Tipo T[], Indice inicial, Indice final, Comparador comp);
+
+
+/**
+   @brief Mezcla dos vectores ordenados sobre otro.
+
+   @param T: vector de elementos. Tiene un número de elementos
+                   mayor o igual a final. Es MODIFICADO.
+   @param inicial: Posición que marca el incio de la parte del
+                   vector a escribir.
+   @param final: Posición detrás de la última de la parte del
+                   vector a escribir
+		   inicial < final.
+   @param U: Vector con los elementos ordenados.
+   @param nu: Número de elementos de U.
+   @param V: Vector con los elementos ordenados.
+   @param nv: Número de elementos de V.
+             nu + nv debe coincidir con final - inicial.
+   @param comp: orden estricto entre elementos.
+
+   En los elementos de T entre las posiciones inicial y final - 1
+   pone ordenados en sentido creciente, de menor a mayor según comp,
+   los elementos de los vectores U y V. Ante elementos equivalentes
+   toma primero los de U, por lo que la mezcla es estable.
+*/
+template <class Tipo, class Comparador>
+inline void fusion(Tipo T[], Indice inicial, Indice final,
+                   const Tipo U[], Indice nu, const Tipo V[], Indice nv,
+                   Comparador comp);
+
+
+/**
+   @brief Ordena un vector por mezcla descendente sin reservas por nivel.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param aux: vector auxiliar de num_elem elementos o NULL. Si es NULL
+               se reserva uno, una única vez. Es MODIFICADO.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   Cambia el orden de los elementos de T de forma que los dispone
+   en sentido creciente de menor a mayor según comp.
+   Aplica el algoritmo de mezcla recursivo, pero en lugar de copiar
+   cada mitad a vectores nuevos alterna T y aux entre niveles: las
+   mitades se ordenan sobre el vector contrario a aquel en el que debe
+   quedar el resultado y se mezclan sobre éste.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+void mergesort_descendente(Tipo T[], Indice num_elem, Tipo aux[] = NULL,
+                           Comparador comp = Comparador());
+
+
+/**
+   @brief Ordena parte de un vector por mezcla descendente sobre dos vectores.
+
+   @param A: vector de elementos. Tiene un número de elementos
+             mayor o igual a final. Es MODIFICADO.
+   @param B: vector auxiliar del mismo tamaño que A. Es MODIFICADO.
+   @param inicial: Posición que marca el incio de la parte a ordenar.
+   @param final: Posición detrás de la última de la parte a ordenar.
+                 inicial < final.
+   @param en_B: si es true el resultado queda en B[inicial, final);
+                si no, en A[inicial, final).
+   @param comp: orden estricto entre elementos.
+
+   Los elementos a ordenar se toman siempre de A[inicial, final).
+*/
+template <class Tipo, class Comparador>
+void mergesort_descendente_lims(Tipo A[], Tipo B[], Indice inicial, Indice final,
+                                bool en_B, Comparador comp);
+
+
+/**
+   @brief Ordena un vector por mezcla ascendente (iterativa).
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param aux: vector auxiliar de num_elem elementos o NULL. Si es NULL
+               se reserva uno, una única vez. Es MODIFICADO.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   Cambia el orden de los elementos de T de forma que los dispone
+   en sentido creciente de menor a mayor según comp.
+   Ordena por inserción tramos de tantos elementos como su umbral
+   (umbrales.h) y después los mezcla por parejas, duplicando el tamaño
+   del tramo en cada pasada y alternando T y aux como origen y destino.
+   Si el número de pasadas es impar, el resultado se copia a T al final.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+void mergesort_ascendente(Tipo T[], Indice num_elem, Tipo aux[] = NULL,
+                          Comparador comp = Comparador());
+
+
+
+/**
+   Implementación de las funciones
+**/
+
+
+template <class Tipo, class Comparador>
+inline void mergesort(Tipo T[], Indice num_elem, Comparador comp)
+{
+  mergesort_lims(T, 0, num_elem, comp);
+}
+
+template <class Tipo, class Comparador>
+void mergesort_lims(Tipo T[], Indice inicial, Indice final, Comparador comp)
+{
+  if (final - inicial < umbral<Tipo>(HIBRIDO_MERGESORT))
+    {
+      insercion_lims(T, inicial, final, comp);
+    } else {
+      Indice k = (final - inicial)/2;
+
+      Tipo * U = reservar_auxiliar<Tipo>(k);
+      assert(U);
+      Indice l, l2;
+      for (l = 0, l2 = inicial; l < k; l++, l2++)
+		U[l] = T[l2];
+
+      Tipo * V = reservar_auxiliar<Tipo>(final - inicial - k);
+      assert(V);
+      for (l = 0; l2 < final; l++, l2++)
+		V[l] = T[l2];
+
+      mergesort_lims(U, 0, k, comp);
+      mergesort_lims(V, 0, final - inicial - k, comp);
+      fusion(T, inicial, final, U, k, V, final - inicial - k, comp);
+      liberar_auxiliar(U);
+      liberar_auxiliar(V);
+    };
+}
+
+
+template <class Tipo, class Comparador>
+inline void fusion(Tipo T[], Indice inicial, Indice final,
+                   const Tipo U[], Indice nu, const Tipo V[], Indice nv,
+                   Comparador comp)
+{
+  Indice j = 0;
+  Indice k = 0;
+  Indice i = inicial;
+  while (j < nu && k < nv)
+    {
+      if (comp(V[k], U[j])) {
+	T[i++] = V[k++];
+      } else{
+	T[i++] = U[j++];
+      };
+    };
+  while (j < nu)
+    T[i++] = U[j++];
+  while (k < nv)
+    T[i++] = V[k++];
+  assert(i == final);
+}
+
+
+template <class Tipo, class Comparador>
+void mergesort_descendente_lims(Tipo A[], Tipo B[], Indice inicial, Indice final,
+                                bool en_B, Comparador comp)
+{
+  if (final - inicial < umbral<Tipo>(HIBRIDO_MERGESORT_DESCENDENTE)) {
+    if (en_B) {
+      std::copy(A + inicial, A + final, B + inicial);
+      insercion_lims(B, inicial, final, comp);
+    } else {
+      insercion_lims(A, inicial, final, comp);
+    }
+    return;
+  }
+
+  Indice k = inicial + (final - inicial) / 2;
+  mergesort_descendente_lims(A, B, inicial, k, !en_B, comp);
+  mergesort_descendente_lims(A, B, k, final, !en_B, comp);
+
+  Tipo * origen = en_B ? A : B;
+  Tipo * destino = en_B ? B : A;
+  fusion(destino, inicial, final, origen + inicial, k - inicial,
+         origen + k, final - k, comp);
+}
+
+
+template <class Tipo, class Comparador>
+void mergesort_descendente(Tipo T[], Indice num_elem, Tipo aux[],
+                           Comparador comp)
+{
+  if (num_elem < umbral<Tipo>(HIBRIDO_MERGESORT_DESCENDENTE)) {
+    insercion_lims(T, 0, num_elem, comp);
+    return;
+  }
+
+  Tipo * propio = aux ? NULL : reservar_auxiliar<Tipo>(num_elem);
+  mergesort_descendente_lims(T, aux ? aux : propio, 0, num_elem, false, comp);
+  liberar_auxiliar(propio);
+}
+
+
+template <class Tipo, class Comparador>
+void mergesort_ascendente(Tipo T[], Indice num_elem, Tipo aux[],
+                          Comparador comp)
+{
+  const int u = umbral<Tipo>(HIBRIDO_MERGESORT_ASCENDENTE);
+  Indice i;
+  for (i = 0; i < num_elem; i += u)
+    insercion_lims(T, i, std::min(i + u, num_elem), comp);
+  if (num_elem <= u)
+    return;
+
+  Tipo * propio = aux ? NULL : reservar_auxiliar<Tipo>(num_elem);
+  Tipo * origen = T;
+  Tipo * destino = aux ? aux : propio;
+
+  for (Indice ancho = u; ancho < num_elem; ancho *= 2) {
+    for (i = 0; i < num_elem; i += 2 * ancho) {
+      Indice k = std::min(i + ancho, num_elem);
+      Indice final = std::min(i + 2 * ancho, num_elem);
+      fusion(destino, i, final, origen + i, k - i, origen + k, final - k, comp);
+    }
+    std::swap(origen, destino);
+  }
+
+  if (origen != T)
+    std::copy(origen, origen + num_elem, T);
+  liberar_auxiliar(propio);
+}
+
+#endif
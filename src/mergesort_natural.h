@@ -0,0 +1,403 @@
+/**
+   @file mergesort_natural.h
+   @brief Ordenación por mezcla natural adaptativa (powersort con galope).
+   @date 2026-10-17
+*/
+
+#ifndef MERGESORT_NATURAL_H
+#define MERGESORT_NATURAL_H
+
+#include "arena.h"
+#include "insercion.h"
+#include "umbrales.h"
+
+#include <functional>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+
+/* ************************************************************ */
+/*  Método de ordenación por mezcla natural  */
+
+/**
+   @brief Ordena un vector mezclando los tramos ordenados que ya tiene.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param aux: vector auxiliar de num_elem / 2 elementos o NULL. Si es
+               NULL se reserva uno, una única vez. Es MODIFICADO.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   Cambia el orden de los elementos de T de forma que los dispone
+   en sentido creciente de menor a mayor según comp.
+   Recorre T de izquierda a derecha buscando tramos crecientes o
+   estrictamente decrecientes (que se invierten); los de menos de
+   umbral<Tipo>(HIBRIDO_MERGESORT_NATURAL) elementos se completan por
+   inserción. Los tramos se mezclan según las reglas de powersort
+   (ver potencia_tramos) con fusion_galope. Con r tramos hace
+   O(n log r) comparaciones, así que un vector ordenado, o con pocos
+   tramos, se ordena en tiempo casi lineal. Es estable.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+void mergesort_natural(Tipo T[], Indice num_elem, Tipo aux[] = NULL,
+                       Comparador comp = Comparador());
+
+
+/**
+   @brief Mezcla dos tramos ordenados consecutivos de un vector, con galope.
+
+   @param T: vector de elementos. Es MODIFICADO.
+   @param inicial: comienzo del primer tramo.
+   @param medio: fin del primer tramo y comienzo del segundo.
+   @param final: fin del segundo tramo.
+   @param aux: vector auxiliar con al menos min(medio - inicial,
+               final - medio) elementos. Es MODIFICADO.
+   @param comp: orden estricto entre elementos.
+
+   Primero descarta, con búsquedas exponenciales, los elementos del
+   principio del primer tramo y del final del segundo que ya están en
+   su sitio. Copia en aux el menor de los dos restos y mezcla hacia
+   delante o hacia atrás. Cuando uno de los tramos gana MIN_GALOPE
+   veces seguidas pasa al modo galope: busca cuántos elementos seguidos
+   toma de cada tramo y los copia de una vez, hasta que ninguno de los
+   dos saca MIN_GALOPE. Ante elementos equivalentes toma primero los del
+   primer tramo, por lo que la mezcla es estable.
+*/
+template <class Tipo, class Comparador>
+void fusion_galope(Tipo T[], Indice inicial, Indice medio, Indice final, Tipo aux[],
+                   Comparador comp);
+
+
+
+/**
+   Implementación de las funciones
+**/
+
+
+/**
+   Victorias seguidas de un tramo a partir de las que se galopa.
+**/
+const int MIN_GALOPE = 7;
+
+
+/**
+   @brief Número de elementos del principio de V que no son mayores que x.
+
+   Busca exponencialmente desde el principio y termina con una búsqueda
+   binaria, así que cuesta O(log k) comparaciones si la respuesta es k.
+*/
+template <class Tipo, class Comparador>
+inline Indice galope_no_mayores(const Tipo & x, const Tipo V[], Indice n,
+                             Comparador comp)
+{
+  Indice ant = 0, sig = 1;
+  while (sig < n && !comp(x, V[sig - 1])) {
+    ant = sig;
+    sig = 2 * sig + 1;
+  }
+  sig = std::min(sig, n);
+  return std::upper_bound(V + ant, V + sig, x, comp) - V;
+}
+
+
+/**
+   @brief Número de elementos del principio de V menores que x.
+*/
+template <class Tipo, class Comparador>
+inline Indice galope_menores(const Tipo & x, const Tipo V[], Indice n,
+                          Comparador comp)
+{
+  Indice ant = 0, sig = 1;
+  while (sig < n && comp(V[sig - 1], x)) {
+    ant = sig;
+    sig = 2 * sig + 1;
+  }
+  sig = std::min(sig, n);
+  return std::lower_bound(V + ant, V + sig, x, comp) - V;
+}
+
+
+/**
+   @brief Número de elementos del final de V mayores que x, buscando
+   desde el final.
+*/
+template <class Tipo, class Comparador>
+inline Indice galope_mayores_final(const Tipo & x, const Tipo V[], Indice n,
+                                Comparador comp)
+{
+  Indice ant = 0, sig = 1;
+  while (sig < n && comp(x, V[n - sig])) {
+    ant = sig;
+    sig = 2 * sig + 1;
+  }
+  sig = std::min(sig, n);
+  return n - (std::upper_bound(V + n - sig, V + n - ant, x, comp) - V);
+}
+
+
+/**
+   @brief Número de elementos del final de V no menores que x, buscando
+   desde el final.
+*/
+template <class Tipo, class Comparador>
+inline Indice galope_no_menores_final(const Tipo & x, const Tipo V[], Indice n,
+                                   Comparador comp)
+{
+  Indice ant = 0, sig = 1;
+  while (sig < n && !comp(V[n - sig], x)) {
+    ant = sig;
+    sig = 2 * sig + 1;
+  }
+  sig = std::min(sig, n);
+  return n - (std::lower_bound(V + n - sig, V + n - ant, x, comp) - V);
+}
+
+
+/**
+   @brief Mezcla hacia delante, con el primer tramo T[inicial, medio)
+   copiado en aux.
+*/
+template <class Tipo, class Comparador>
+void fusion_galope_delante(Tipo T[], Indice inicial, Indice medio, Indice final,
+                           Tipo aux[], Comparador comp)
+{
+  Indice nu = medio - inicial;
+  std::copy(T + inicial, T + medio, aux);
+  Indice i = 0, j = medio, k = inicial;
+
+  // T[medio] es menor que aux[0], o no se habría descartado
+  T[k++] = T[j++];
+  while (i < nu && j < final) {
+    // Uno a uno mientras ninguno de los tramos gane MIN_GALOPE seguidas
+    Indice gana_u = 0, gana_v = 0;
+    while (gana_u < MIN_GALOPE && gana_v < MIN_GALOPE) {
+      if (comp(T[j], aux[i])) {
+        T[k++] = T[j++];
+        gana_v++;
+        gana_u = 0;
+        if (j == final)
+          goto fin;
+      } else {
+        T[k++] = aux[i++];
+        gana_u++;
+        gana_v = 0;
+        if (i == nu)
+          goto fin;
+      }
+    }
+
+    // Galope: bloques de cada tramo de una vez
+    do {
+      gana_u = galope_no_mayores(T[j], aux + i, nu - i, comp);
+      k = std::copy(aux + i, aux + i + gana_u, T + k) - T;
+      i += gana_u;
+      if (i == nu)
+        goto fin;
+      T[k++] = T[j++];
+      if (j == final)
+        goto fin;
+
+      gana_v = galope_menores(aux[i], T + j, final - j, comp);
+      k = std::copy(T + j, T + j + gana_v, T + k) - T;
+      j += gana_v;
+      if (j == final)
+        goto fin;
+      T[k++] = aux[i++];
+      if (i == nu)
+        goto fin;
+    } while (gana_u >= MIN_GALOPE || gana_v >= MIN_GALOPE);
+  }
+
+fin:
+  // Lo que quede del segundo tramo ya está en su sitio
+  std::copy(aux + i, aux + nu, T + k);
+}
+
+
+/**
+   @brief Mezcla hacia atrás, con el segundo tramo T[medio, final)
+   copiado en aux.
+*/
+template <class Tipo, class Comparador>
+void fusion_galope_detras(Tipo T[], Indice inicial, Indice medio, Indice final,
+                          Tipo aux[], Comparador comp)
+{
+  Indice nv = final - medio;
+  std::copy(T + medio, T + final, aux);
+  Indice i = medio - 1, j = nv - 1, k = final - 1;
+
+  // T[medio - 1] es mayor que aux[nv - 1], o no se habría descartado
+  T[k--] = T[i--];
+  while (i >= inicial && j >= 0) {
+    Indice gana_u = 0, gana_v = 0;
+    while (gana_u < MIN_GALOPE && gana_v < MIN_GALOPE) {
+      if (comp(aux[j], T[i])) {
+        T[k--] = T[i--];
+        gana_u++;
+        gana_v = 0;
+        if (i < inicial)
+          goto fin;
+      } else {
+        T[k--] = aux[j--];
+        gana_v++;
+        gana_u = 0;
+        if (j < 0)
+          goto fin;
+      }
+    }
+
+    do {
+      gana_u = galope_mayores_final(aux[j], T + inicial, i - inicial + 1, comp);
+      k -= gana_u;
+      i -= gana_u;
+      std::copy_backward(T + i + 1, T + i + 1 + gana_u, T + k + 1 + gana_u);
+      if (i < inicial)
+        goto fin;
+      T[k--] = aux[j--];
+      if (j < 0)
+        goto fin;
+
+      gana_v = galope_no_menores_final(T[i], aux, j + 1, comp);
+      k -= gana_v;
+      j -= gana_v;
+      std::copy(aux + j + 1, aux + j + 1 + gana_v, T + k + 1);
+      if (j < 0)
+        goto fin;
+      T[k--] = T[i--];
+      if (i < inicial)
+        goto fin;
+    } while (gana_u >= MIN_GALOPE || gana_v >= MIN_GALOPE);
+  }
+
+fin:
+  // Lo que quede del primer tramo ya está en su sitio
+  std::copy(aux, aux + j + 1, T + k - j);
+}
+
+
+template <class Tipo, class Comparador>
+void fusion_galope(Tipo T[], Indice inicial, Indice medio, Indice final, Tipo aux[],
+                   Comparador comp)
+{
+  // Los del primer tramo no mayores que T[medio] ya están en su sitio
+  inicial += galope_no_mayores(T[medio], T + inicial, medio - inicial, comp);
+  if (inicial == medio)
+    return;
+  // Y los del segundo no menores que T[medio - 1]
+  final = medio + galope_menores(T[medio - 1], T + medio, final - medio, comp);
+
+  if (medio - inicial <= final - medio)
+    fusion_galope_delante(T, inicial, medio, final, aux, comp);
+  else
+    fusion_galope_detras(T, inicial, medio, final, aux, comp);
+}
+
+
+/**
+   @brief Encuentra el tramo que empieza en inicial y lo deja creciente.
+   @return Fin del tramo.
+
+   Un tramo estrictamente decreciente se invierte; con iguales no se
+   invierte para no romper la estabilidad.
+*/
+template <class Tipo, class Comparador>
+Indice tramo_natural(Tipo T[], Indice inicial, Indice final, Comparador comp)
+{
+  Indice k = inicial + 1;
+  if (k == final)
+    return k;
+  if (comp(T[k], T[inicial])) {
+    while (k + 1 < final && comp(T[k + 1], T[k]))
+      k++;
+    std::reverse(T + inicial, T + k + 1);
+  } else {
+    while (k + 1 < final && !comp(T[k + 1], T[k]))
+      k++;
+  }
+  return k + 1;
+}
+
+
+/**
+   @brief Potencia del límite entre dos tramos consecutivos (powersort).
+
+   @param inicial: comienzo del primer tramo.
+   @param n1: elementos del primer tramo.
+   @param n2: elementos del segundo tramo.
+   @param num_elem: elementos del vector.
+
+   Es la profundidad, en el árbol de mezclas perfectamente equilibrado
+   sobre [0, num_elem), del nodo que separa los puntos medios de los
+   dos tramos: el número de bits iniciales iguales de sus posiciones
+   relativas más uno. Mezclar antes los límites de mayor potencia da un
+   árbol de mezclas casi óptimo para los tamaños de los tramos.
+*/
+inline int potencia_tramos(Indice inicial, Indice n1, Indice n2, Indice num_elem)
+{
+  // Puntos medios en [0, 1) con 63 bits de fracción; difieren en más
+  // de 2^-63 porque num_elem < 2^62
+  typedef unsigned __int128 Doble;
+  uint64_t a = ((Doble) (2 * inicial + n1) << 62) / num_elem;
+  uint64_t b = ((Doble) (2 * inicial + 2 * n1 + n2) << 62) / num_elem;
+  return __builtin_clzll(a ^ b);
+}
+
+
+template <class Tipo, class Comparador>
+void mergesort_natural(Tipo T[], Indice num_elem, Tipo aux[], Comparador comp)
+{
+  if (num_elem <= 1)
+    return;
+  const int u = umbral<Tipo>(HIBRIDO_MERGESORT_NATURAL);
+  Tipo * propio = aux ? NULL : reservar_auxiliar<Tipo>(num_elem / 2 + 1);
+  if (propio)
+    aux = propio;
+
+  // Pila de tramos pendientes: comienzo y potencia del límite con el
+  // siguiente. Las potencias crecen hacia la cima, así que hay como
+  // mucho una por nivel del árbol.
+  Indice comienzo[64];
+  int potencia[64];
+  int altura = 0;
+
+  Indice inicial = 0;
+  Indice fin = tramo_natural(T, 0, num_elem, comp);
+  if (fin - inicial < u && fin < num_elem) {
+    fin = std::min(inicial + u, num_elem);
+    insercion_lims(T, inicial, fin, comp);
+  }
+  while (fin < num_elem) {
+    Indice siguiente = fin;
+    Indice fin_siguiente = tramo_natural(T, siguiente, num_elem, comp);
+    if (fin_siguiente - siguiente < u && fin_siguiente < num_elem) {
+      fin_siguiente = std::min(siguiente + u, num_elem);
+      insercion_lims(T, siguiente, fin_siguiente, comp);
+    }
+
+    int p = potencia_tramos(inicial, fin - inicial, fin_siguiente - siguiente,
+                            num_elem);
+    while (altura > 0 && potencia[altura - 1] > p) {
+      altura--;
+      fusion_galope(T, comienzo[altura], inicial, fin, aux, comp);
+      inicial = comienzo[altura];
+    }
+    comienzo[altura] = inicial;
+    potencia[altura] = p;
+    altura++;
+
+    inicial = siguiente;
+    fin = fin_siguiente;
+  }
+  while (altura > 0) {
+    altura--;
+    fusion_galope(T, comienzo[altura], inicial, fin, aux, comp);
+    inicial = comienzo[altura];
+  }
+
+  liberar_auxiliar(propio);
+}
+
+
+#endif
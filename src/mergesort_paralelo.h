@@ -0,0 +1,178 @@
+/**
+   @file mergesort_paralelo.h
+   @brief Ordenación por mezcla paralela sobre el planificador con robo de tareas.
+   @date 2026-10-17
+*/
+
+#ifndef MERGESORT_PARALELO_H
+#define MERGESORT_PARALELO_H
+
+#include "arena.h"
+#include "mergesort.h"
+#include "planificador.h"
+
+#include <functional>
+#include <algorithm>
+
+
+/* ************************************************************ */
+/*  Método de ordenación por mezcla paralelo  */
+
+/**
+   @brief Ordena un vector por el método de mezcla usando varios hilos.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param planificador: hilos en los que se reparte el trabajo.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   Cambia el orden de los elementos de T de forma que los dispone
+   en sentido creciente de menor a mayor según comp.
+   Cada mitad se ordena en una tarea distinta hasta llegar a
+   CORTE_MS_PARALELO elementos, donde se aplica la mezcla descendente
+   secuencial sobre el mismo vector auxiliar.
+   Las mezclas grandes también se reparten entre tareas (ver
+   fusion_paralela), de modo que la última mezcla no se queda en un
+   solo hilo. Usa un vector auxiliar de num_elem elementos.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+void mergesort_paralelo(Tipo T[], Indice num_elem, Planificador & planificador,
+                        Comparador comp = Comparador());
+
+
+/**
+   @brief Mezcla en paralelo dos vectores ordenados sobre otro.
+
+   @param T: vector destino de nu + nv elementos. Es MODIFICADO.
+   @param U: vector ordenado de nu elementos.
+   @param nu: número de elementos de U.
+   @param V: vector ordenado de nv elementos.
+   @param nv: número de elementos de V.
+   @param planificador: hilos en los que se reparte el trabajo.
+   @param comp: orden estricto entre elementos.
+
+   Divide T en tramos de igual tamaño y, para cada frontera, busca con
+   co_rango cuántos elementos aporta U y cuántos V. Cada tramo se mezcla
+   con fusion en una tarea independiente. Es estable como fusion.
+*/
+template <class Tipo, class Comparador>
+void fusion_paralela(Tipo T[], const Tipo U[], Indice nu, const Tipo V[], Indice nv,
+                     Planificador & planificador, Comparador comp);
+
+
+/**
+   @brief Co-rango de una posición de la mezcla de dos vectores ordenados.
+
+   @param k: posición de la mezcla. 0 <= k <= nu + nv.
+   @return Número i de elementos de U entre los k primeros de la mezcla
+           estable de U y V (los otros k - i son de V).
+*/
+template <class Tipo, class Comparador>
+inline Indice co_rango(Indice k, const Tipo U[], Indice nu, const Tipo V[], Indice nv,
+                    Comparador comp);
+
+
+
+/**
+   Implementación de las funciones
+**/
+
+
+const int CORTE_MS_PARALELO = 1 << 14;
+const int CORTE_FUSION_PARALELA = 1 << 15;
+
+
+template <class Tipo, class Comparador>
+inline Indice co_rango(Indice k, const Tipo U[], Indice nu, const Tipo V[], Indice nv,
+                    Comparador comp)
+{
+  Indice bajo = std::max<Indice>(0, k - nv);
+  Indice alto = std::min(k, nu);
+  while (bajo < alto) {
+    Indice i = bajo + (alto - bajo) / 2;
+    Indice j = k - i;
+    // Si V[j-1] no va antes que U[i], U[i] entra en los k primeros
+    if (j > 0 && !comp(V[j-1], U[i]))
+      bajo = i + 1;
+    else
+      alto = i;
+  }
+  return bajo;
+}
+
+
+template <class Tipo, class Comparador>
+void fusion_paralela(Tipo T[], const Tipo U[], Indice nu, const Tipo V[], Indice nv,
+                     Planificador & planificador, Comparador comp)
+{
+  Indice total = nu + nv;
+  Indice tramos = std::min<Indice>(4 * planificador.hilos(), total / CORTE_FUSION_PARALELA);
+  if (tramos <= 1) {
+    fusion(T, 0, total, U, nu, V, nv, comp);
+    return;
+  }
+
+  GrupoTareas grupo;
+  for (Indice t = 0; t < tramos; t++) {
+    Indice k1 = total * t / tramos;
+    Indice k2 = total * (t + 1) / tramos;
+    planificador.lanzar(grupo, [=]() {
+      Indice i1 = co_rango(k1, U, nu, V, nv, comp);
+      Indice i2 = co_rango(k2, U, nu, V, nv, comp);
+      fusion(T, k1, k2, U + i1, i2 - i1, V + (k1 - i1), (k2 - i2) - (k1 - i1),
+             comp);
+    });
+  }
+  planificador.esperar(grupo);
+}
+
+
+/**
+   @brief Ordena A[inicial, final) dejando el resultado en A o en B.
+
+   A y B tienen el mismo tamaño. Las mitades se ordenan sobre el vector
+   contrario al destino, y se mezclan sobre el destino, de modo que
+   cada nivel alterna de vector sin copias intermedias.
+*/
+template <class Tipo, class Comparador>
+void mergesort_paralelo_lims(Tipo A[], Tipo B[], Indice inicial, Indice final,
+                             bool en_B, Planificador & planificador,
+                             Comparador comp)
+{
+  if (final - inicial <= CORTE_MS_PARALELO) {
+    mergesort_descendente_lims(A, B, inicial, final, en_B, comp);
+    return;
+  }
+
+  Indice k = inicial + (final - inicial) / 2;
+  GrupoTareas grupo;
+  planificador.lanzar(grupo, [=, &planificador]() {
+    mergesort_paralelo_lims(A, B, inicial, k, !en_B, planificador, comp);
+  });
+  mergesort_paralelo_lims(A, B, k, final, !en_B, planificador, comp);
+  planificador.esperar(grupo);
+
+  Tipo * origen = en_B ? A : B;
+  Tipo * destino = en_B ? B : A;
+  fusion_paralela(destino + inicial, origen + inicial, k - inicial,
+                  origen + k, final - k, planificador, comp);
+}
+
+
+template <class Tipo, class Comparador>
+void mergesort_paralelo(Tipo T[], Indice num_elem, Planificador & planificador,
+                        Comparador comp)
+{
+  if (num_elem <= CORTE_MS_PARALELO || planificador.hilos() == 1) {
+    mergesort_descendente(T, num_elem, (Tipo *) NULL, comp);
+    return;
+  }
+
+  Tipo * aux = reservar_auxiliar<Tipo>(num_elem);
+  mergesort_paralelo_lims(T, aux, 0, num_elem, false, planificador, comp);
+  liberar_auxiliar(aux);
+}
+
+
+#endif
@@ -0,0 +1,336 @@
+/**
+   @file parcial.h
+   @brief Selección del k-ésimo, k menores y ordenación parcial.
+   @date 2026-10-17
+*/
+
+#ifndef PARCIAL_H
+#define PARCIAL_H
+
+#include "quicksort.h"
+#include "heapsort.h"
+#include "insercion.h"
+#include "umbrales.h"
+
+#include <functional>
+#include <algorithm>
+#include <vector>
+
+
+/* ************************************************************ */
+/*  Selección y ordenación parcial  */
+
+/**
+   @brief Sitúa en T[k] el elemento que ocuparía esa posición con T ordenado.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param k: posición buscada. 0 <= k < num_elem.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   Deja en [0, k) elementos no mayores que T[k] y en (k, num_elem)
+   elementos no menores, en cualquier orden (como std::nth_element).
+   Aplica quickselect (introselect): divide con elegir_pivote y
+   dividir_qs y sigue sólo por la parte que contiene k. Si la
+   profundidad supera 2 log2(num_elem) termina con seleccion_monton,
+   de modo que el caso medio es O(n) y el peor O(n log n).
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+inline void quickselect(Tipo T[], Indice num_elem, Indice k,
+                        Comparador comp = Comparador());
+
+
+/**
+   @brief Selecciona en parte de un vector con profundidad acotada.
+
+   @param T: vector de elementos. Tiene un número de elementos
+                   mayor o igual a final. Es MODIFICADO.
+   @param inicial: Posición de inicio del tramo.
+   @param final: Posición detrás de la última del tramo.
+		   inicial <= k < final.
+   @param k: posición buscada.
+   @param profundidad: número de particiones permitidas antes de
+                   recurrir a seleccion_monton.
+   @param comp: orden estricto entre elementos.
+*/
+template <class Tipo, class Comparador>
+void quickselect_lims(Tipo T[], Indice inicial, Indice final, Indice k,
+                      int profundidad, Comparador comp);
+
+
+/**
+   @brief Selecciona en parte de un vector con un montón.
+
+   @param T: vector de elementos. Es MODIFICADO.
+   @param inicial: Posición de inicio del tramo.
+   @param final: Posición detrás de la última del tramo.
+		   inicial <= k < final.
+   @param k: posición buscada.
+   @param comp: orden estricto entre elementos.
+
+   Hace un montón con los elementos del lado más corto de k (los de
+   [inicial, k] o los de [k, final)), cuya raíz es el candidato a
+   T[k], y le pasa el resto del tramo: cada elemento que debería estar
+   en ese lado sustituye a la raíz y se reajusta. Es O(n log m), con m
+   el tamaño del lado corto.
+*/
+template <class Tipo, class Comparador>
+void seleccion_monton(Tipo T[], Indice inicial, Indice final, Indice k,
+                      Comparador comp);
+
+
+/**
+   @brief Ordena los k menores elementos de un vector.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem >= 0.
+   @param k: número de elementos ordenados. 0 <= k. Si k >= num_elem
+             se ordena todo el vector.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   Deja en [0, k) los k menores en sentido creciente según comp y el
+   resto, en cualquier orden, detrás (como std::partial_sort). Separa
+   los k menores con quickselect y los ordena con quicksort_robusto, en
+   O(n + k log k).
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+void ordenacion_parcial(Tipo T[], Indice num_elem, Indice k,
+                        Comparador comp = Comparador());
+
+
+/**
+   @brief Copia en orden los k menores elementos de un vector.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+   @param num_elem: número de elementos. num_elem >= 0.
+   @param k: número de elementos buscados. 0 <= k.
+   @param salida: vector de min(k, num_elem) elementos. Es MODIFICADO.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   No modifica T. Recorre T una vez con un montón de k elementos en
+   salida, como MenoresK, y lo ordena al final. Es O(n log k).
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+void menores_k(const Tipo T[], Indice num_elem, Indice k, Tipo salida[],
+               Comparador comp = Comparador());
+
+
+/**
+   @brief Los k menores de una secuencia de elementos que llegan de uno en uno.
+
+   Guarda un montón (reajustar) de los k menores vistos, con el mayor
+   de ellos en la raíz: cada elemento nuevo se descarta con una
+   comparación o sustituye a la raíz con O(log k). No necesita tener
+   toda la entrada en memoria.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+class MenoresK {
+public:
+  /**
+     @param k: número de elementos que se conservan. k > 0.
+     @param comp: orden estricto entre elementos.
+  */
+  explicit MenoresK(Indice k, Comparador comp = Comparador());
+
+  void insertar(const Tipo & x);
+
+  void insertar(const Tipo T[], Indice num_elem);
+
+  /**
+     @brief Número de elementos conservados, min(k, vistos).
+  */
+  Indice num_elem() const { return monton.size(); }
+
+  /**
+     @brief El k-ésimo menor de los vistos. num_elem() == k.
+  */
+  const Tipo & maximo() const { return monton[0]; }
+
+  /**
+     @brief Copia los conservados en sentido creciente en salida, que
+     tiene num_elem() elementos. Es MODIFICADO.
+  */
+  void ordenados(Tipo salida[]) const;
+
+  void vaciar() { monton.clear(); }
+
+private:
+  std::vector<Tipo> monton;
+  Indice k;
+  Comparador comp;
+};
+
+
+
+/**
+   Implementación de las funciones
+**/
+
+
+template <class Tipo, class Comparador>
+inline void quickselect(Tipo T[], Indice num_elem, Indice k, Comparador comp)
+{
+  int profundidad = 0;
+  for (Indice n = num_elem; n > 1; n /= 2)
+    profundidad += 2;
+  quickselect_lims(T, 0, num_elem, k, profundidad, comp);
+}
+
+
+template <class Tipo, class Comparador>
+void quickselect_lims(Tipo T[], Indice inicial, Indice final, Indice k,
+                      int profundidad, Comparador comp)
+{
+  const int u = umbral<Tipo>(HIBRIDO_QUICKSORT);
+  Indice p;
+  while (final - inicial >= u) {
+    if (profundidad == 0) {
+      seleccion_monton(T, inicial, final, k, comp);
+      return;
+    }
+    profundidad--;
+
+    elegir_pivote(T, inicial, final, comp);
+    dividir_qs(T, inicial, final, p, comp);
+    if (k == p)
+      return;
+    if (k < p)
+      final = p;
+    else
+      inicial = p + 1;
+  }
+  insercion_lims(T, inicial, final, comp);
+}
+
+
+/**
+   @brief Pasa x a un montón de los m menores si es menor que su raíz.
+*/
+template <class Tipo, class Comparador>
+inline void sustituir_raiz(Tipo M[], Indice m, const Tipo & x, Comparador comp)
+{
+  if (comp(x, M[0])) {
+    M[0] = x;
+    reajustar(M, m, 0, comp);
+  }
+}
+
+
+template <class Tipo, class Comparador>
+void seleccion_monton(Tipo T[], Indice inicial, Indice final, Indice k,
+                      Comparador comp)
+{
+  Indice i;
+  if (k - inicial < final - k) {
+    // Montón de máximos con los k - inicial + 1 menores
+    Tipo * M = T + inicial;
+    Indice m = k - inicial + 1;
+    for (i = m / 2; i >= 0; i--)
+      reajustar(M, m, i, comp);
+    for (i = k + 1; i < final; i++)
+      if (comp(T[i], M[0])) {
+        std::swap(T[i], M[0]);
+        reajustar(M, m, 0, comp);
+      }
+    std::swap(M[0], T[k]);
+  } else {
+    // Montón de mínimos con los final - k mayores
+    auto inverso = [comp](const Tipo & a, const Tipo & b) { return comp(b, a); };
+    Tipo * M = T + k;
+    Indice m = final - k;
+    for (i = m / 2; i >= 0; i--)
+      reajustar(M, m, i, inverso);
+    for (i = inicial; i < k; i++)
+      if (comp(M[0], T[i])) {
+        std::swap(T[i], M[0]);
+        reajustar(M, m, 0, inverso);
+      }
+  }
+}
+
+
+template <class Tipo, class Comparador>
+void ordenacion_parcial(Tipo T[], Indice num_elem, Indice k, Comparador comp)
+{
+  if (k <= 0)
+    return;
+  if (k >= num_elem) {
+    quicksort_robusto(T, num_elem, comp);
+    return;
+  }
+  quickselect(T, num_elem, k - 1, comp);
+  // quickselect ya ha dejado en T[k - 1] el mayor de los k
+  if (k > 1)
+    quicksort_robusto(T, k - 1, comp);
+}
+
+
+template <class Tipo, class Comparador>
+void menores_k(const Tipo T[], Indice num_elem, Indice k, Tipo salida[],
+               Comparador comp)
+{
+  Indice m = std::min(k, num_elem);
+  if (m <= 0)
+    return;
+  std::copy(T, T + m, salida);
+  Indice i;
+  for (i = m / 2; i >= 0; i--)
+    reajustar(salida, m, i, comp);
+  for (i = m; i < num_elem; i++)
+    sustituir_raiz(salida, m, T[i], comp);
+  for (i = m - 1; i >= 1; i--) {
+    std::swap(salida[0], salida[i]);
+    reajustar(salida, i, 0, comp);
+  }
+}
+
+
+template <class Tipo, class Comparador>
+MenoresK<Tipo, Comparador>::MenoresK(Indice k, Comparador comp)
+  : k(k), comp(comp)
+{
+  monton.reserve(k);
+}
+
+
+template <class Tipo, class Comparador>
+void MenoresK<Tipo, Comparador>::insertar(const Tipo & x)
+{
+  Indice m = monton.size();
+  if (m == k) {
+    sustituir_raiz(&monton[0], k, x, comp);
+    return;
+  }
+  monton.push_back(x);
+  // Se hace montón al llenarse; hasta entonces sólo se acumula
+  if (m + 1 == k)
+    for (Indice i = k / 2; i >= 0; i--)
+      reajustar(&monton[0], k, i, comp);
+}
+
+
+template <class Tipo, class Comparador>
+void MenoresK<Tipo, Comparador>::insertar(const Tipo T[], Indice num_elem)
+{
+  Indice i = 0;
+  for (; i < num_elem && (Indice) monton.size() < k; i++)
+    insertar(T[i]);
+  for (; i < num_elem; i++)
+    sustituir_raiz(&monton[0], k, T[i], comp);
+}
+
+
+template <class Tipo, class Comparador>
+void MenoresK<Tipo, Comparador>::ordenados(Tipo salida[]) const
+{
+  Indice m = monton.size();
+  if (m == 0)
+    return;
+  std::copy(monton.begin(), monton.end(), salida);
+  heapsort(salida, m, comp);
+}
+
+
+#endif
@@ -0,0 +1,330 @@
+/**
+   @file particion_vectorial.cpp
+   @brief Partición de vectores de float con instrucciones SIMD (AVX2, AVX-512).
+   @date 2026-10-17
+
+   Los núcleos vectoriales se compilan con el atributo target de GCC,
+   así que el resto del programa no necesita -mavx2 y el núcleo se
+   elige en tiempo de ejecución con __builtin_cpu_supports.
+
+   Todos los núcleos vectoriales siguen el mismo esquema: se guardan en
+   registros el primer y el último bloque del tramo, lo que deja un
+   hueco de un bloque en cada extremo, y se leen bloques del extremo
+   con menos hueco libre. Cada bloque leído se compara con el pivote y
+   sus menores se escriben a continuación de los menores ya colocados
+   por la izquierda y sus mayores delante de los mayores por la
+   derecha. Como cada bloque leído libera tanto hueco como ocupa, las
+   escrituras nunca alcanzan elementos sin leer. Los menos de un
+   bloque que sobran al final se reparten en código escalar.
+*/
+
+
+#include "particion_vectorial.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define PARTICION_X86
+#include <immintrin.h>
+#endif
+
+
+/**
+   @brief Compara con el pivote según se quieran los iguales a la izquierda.
+*/
+template <bool Iguales>
+static inline bool a_la_izquierda(float x, float pivote)
+{
+  return Iguales ? x <= pivote : x < pivote;
+}
+
+
+/**
+   @brief Partición de Lomuto sin saltos dependientes de los datos.
+*/
+template <bool Iguales>
+static Indice lomuto(float T[], Indice inicial, Indice final, float pivote)
+{
+  Indice m = inicial;
+  for (Indice i = inicial; i < final; i++) {
+    float x = T[i];
+    bool s = a_la_izquierda<Iguales>(x, pivote);
+    T[i] = T[m];
+    T[m] = x;
+    m += s;
+  }
+  return m;
+}
+
+
+static Indice particion_escalar(float T[], Indice inicial, Indice final, float pivote,
+                             bool iguales)
+{
+  return iguales ? lomuto<true>(T, inicial, final, pivote)
+                 : lomuto<false>(T, inicial, final, pivote);
+}
+
+
+/**
+   @brief Reparte n elementos ya leídos en el hueco [wi, wd) de T.
+
+   El hueco tiene exactamente n posiciones. Cada elemento se escribe en
+   los dos extremos y sólo avanza el que le corresponde.
+*/
+template <bool Iguales>
+static void repartir(const float resto[], Indice n, float T[], Indice & wi, Indice & wd,
+                     float pivote)
+{
+  for (Indice i = 0; i < n; i++) {
+    float x = resto[i];
+    bool s = a_la_izquierda<Iguales>(x, pivote);
+    T[wi] = x;
+    T[wd - 1] = x;
+    wi += s;
+    wd -= !s;
+  }
+}
+
+
+#ifdef PARTICION_X86
+
+/* ************************************************************ */
+/*  AVX2: 8 floats por bloque  */
+
+/**
+   @brief Permutación de cada máscara de comparación de 8 bits.
+
+   La fila m lleva primero los carriles con su bit activo en m y
+   después el resto, ambos en orden creciente.
+*/
+struct TablaPermutaciones {
+  alignas(32) int32_t fila[256][8];
+
+  TablaPermutaciones()
+  {
+    for (int m = 0; m < 256; m++) {
+      int k = 0;
+      for (int c = 0; c < 8; c++)
+        if (m & (1 << c))
+          fila[m][k++] = c;
+      for (int c = 0; c < 8; c++)
+        if (!(m & (1 << c)))
+          fila[m][k++] = c;
+    }
+  }
+};
+
+static const TablaPermutaciones PERMUTACIONES;
+
+
+template <int Predicado>
+__attribute__((target("avx2")))
+static inline void bloque_avx2(float T[], __m256 v, __m256 pivote,
+                               Indice & wi, Indice & wd)
+{
+  int mascara = _mm256_movemask_ps(_mm256_cmp_ps(v, pivote, Predicado));
+  __m256i orden = _mm256_load_si256((const __m256i *) PERMUTACIONES.fila[mascara]);
+  __m256 w = _mm256_permutevar8x32_ps(v, orden);
+  int menores = __builtin_popcount(mascara);
+  // Los menores quedan al principio de w y los mayores al final
+  _mm256_storeu_ps(T + wi, w);
+  _mm256_storeu_ps(T + wd - 8, w);
+  wi += menores;
+  wd -= 8 - menores;
+}
+
+
+template <int Predicado>
+__attribute__((target("avx2")))
+static Indice particion_avx2(float T[], Indice inicial, Indice final, float pivote)
+{
+  const int V = 8;
+  const bool iguales = Predicado == _CMP_LE_OQ;
+  if (final - inicial < 2 * V)
+    return particion_escalar(T, inicial, final, pivote, iguales);
+
+  __m256 p = _mm256_set1_ps(pivote);
+  __m256 izq = _mm256_loadu_ps(T + inicial);
+  __m256 der = _mm256_loadu_ps(T + final - V);
+  Indice li = inicial + V, ld = final - V;
+  Indice wi = inicial, wd = final;
+
+  while (ld - li >= V) {
+    __m256 v;
+    if (li - wi <= wd - ld) {
+      v = _mm256_loadu_ps(T + li);
+      li += V;
+    } else {
+      ld -= V;
+      v = _mm256_loadu_ps(T + ld);
+    }
+    bloque_avx2<Predicado>(T, v, p, wi, wd);
+  }
+
+  // Queda libre todo [wi, wd) salvo la cola [li, ld), de menos de V
+  float resto[2 * V];
+  Indice r = ld - li;
+  memcpy(resto, T + li, r * sizeof(float));
+  _mm256_storeu_ps(resto + r, der);
+  bloque_avx2<Predicado>(T, izq, p, wi, wd);
+  if (iguales)
+    repartir<true>(resto, r + V, T, wi, wd, pivote);
+  else
+    repartir<false>(resto, r + V, T, wi, wd, pivote);
+  return wi;
+}
+
+
+/* ************************************************************ */
+/*  AVX-512: 16 floats por bloque  */
+
+template <int Predicado>
+__attribute__((target("avx512f")))
+static inline void bloque_avx512(float T[], __m512 v, __m512 pivote,
+                                 Indice & wi, Indice & wd)
+{
+  __mmask16 mascara = _mm512_cmp_ps_mask(v, pivote, Predicado);
+  int menores = __builtin_popcount(mascara);
+  _mm512_mask_compressstoreu_ps(T + wi, mascara, v);
+  wi += menores;
+  wd -= 16 - menores;
+  _mm512_mask_compressstoreu_ps(T + wd, (__mmask16) ~mascara, v);
+}
+
+
+template <int Predicado>
+__attribute__((target("avx512f")))
+static Indice particion_avx512(float T[], Indice inicial, Indice final, float pivote)
+{
+  const int V = 16;
+  const bool iguales = Predicado == _CMP_LE_OQ;
+  if (final - inicial < 2 * V)
+    return particion_escalar(T, inicial, final, pivote, iguales);
+
+  __m512 p = _mm512_set1_ps(pivote);
+  __m512 izq = _mm512_loadu_ps(T + inicial);
+  __m512 der = _mm512_loadu_ps(T + final - V);
+  Indice li = inicial + V, ld = final - V;
+  Indice wi = inicial, wd = final;
+
+  while (ld - li >= V) {
+    __m512 v;
+    if (li - wi <= wd - ld) {
+      v = _mm512_loadu_ps(T + li);
+      li += V;
+    } else {
+      ld -= V;
+      v = _mm512_loadu_ps(T + ld);
+    }
+    bloque_avx512<Predicado>(T, v, p, wi, wd);
+  }
+
+  // vcompress sólo escribe los carriles elegidos, así que basta con
+  // poner a salvo la cola antes de colocar los dos bloques guardados
+  float resto[V];
+  Indice r = ld - li;
+  memcpy(resto, T + li, r * sizeof(float));
+  bloque_avx512<Predicado>(T, izq, p, wi, wd);
+  bloque_avx512<Predicado>(T, der, p, wi, wd);
+  if (iguales)
+    repartir<true>(resto, r, T, wi, wd, pivote);
+  else
+    repartir<false>(resto, r, T, wi, wd, pivote);
+  return wi;
+}
+
+
+static Indice particion_avx2(float T[], Indice inicial, Indice final, float pivote,
+                          bool iguales)
+{
+  return iguales ? particion_avx2<_CMP_LE_OQ>(T, inicial, final, pivote)
+                 : particion_avx2<_CMP_LT_OQ>(T, inicial, final, pivote);
+}
+
+
+static Indice particion_avx512(float T[], Indice inicial, Indice final, float pivote,
+                            bool iguales)
+{
+  return iguales ? particion_avx512<_CMP_LE_OQ>(T, inicial, final, pivote)
+                 : particion_avx512<_CMP_LT_OQ>(T, inicial, final, pivote);
+}
+
+#endif
+
+
+
+/* ************************************************************ */
+/*  Elección del núcleo  */
+
+typedef Indice (*FuncionParticion)(float T[], Indice inicial, Indice final,
+                                float pivote, bool iguales);
+
+static const FuncionParticion FUNCIONES[NUM_NUCLEOS] = {
+  particion_escalar,
+#ifdef PARTICION_X86
+  particion_avx2,
+  particion_avx512,
+#else
+  particion_escalar,
+  particion_escalar,
+#endif
+};
+
+static const char * NOMBRES[NUM_NUCLEOS] = { "escalar", "avx2", "avx512" };
+
+
+bool nucleo_disponible(NucleoParticion n)
+{
+#ifdef PARTICION_X86
+  // Puede llamarse desde constructores estáticos, antes de main
+  __builtin_cpu_init();
+  switch (n) {
+  case PARTICION_ESCALAR: return true;
+  case PARTICION_AVX2:    return __builtin_cpu_supports("avx2");
+  case PARTICION_AVX512:  return __builtin_cpu_supports("avx512f");
+  default:                return false;
+  }
+#else
+  return n == PARTICION_ESCALAR;
+#endif
+}
+
+
+static NucleoParticion detectar_nucleo()
+{
+  int n = NUM_NUCLEOS - 1;
+  while (!nucleo_disponible(NucleoParticion(n)))
+    n--;
+  return NucleoParticion(n);
+}
+
+static NucleoParticion nucleo = detectar_nucleo();
+
+
+Indice particion_vectorial(float T[], Indice inicial, Indice final, float pivote,
+                        bool iguales)
+{
+  return FUNCIONES[nucleo](T, inicial, final, pivote, iguales);
+}
+
+
+NucleoParticion nucleo_particion()
+{
+  return nucleo;
+}
+
+
+bool fijar_nucleo_particion(NucleoParticion n)
+{
+  if (n < 0 || n >= NUM_NUCLEOS || !nucleo_disponible(n))
+    return false;
+  nucleo = n;
+  return true;
+}
+
+
+const char * nombre_nucleo(NucleoParticion n)
+{
+  return NOMBRES[n];
+}
@@ -0,0 +1,70 @@
+/**
+   @file particion_vectorial.h
+   @brief Partición de vectores de float con instrucciones SIMD (AVX2, AVX-512).
+   @date 2026-10-17
+*/
+
+#ifndef PARTICION_VECTORIAL_H
+#define PARTICION_VECTORIAL_H
+
+#include "tipos.h"
+
+
+/**
+   @brief Implementaciones de la partición.
+
+   La elegida por defecto es la más ancha que ofrezcan el procesador y
+   el sistema operativo, de modo que el mismo ejecutable funciona en
+   cualquier x86-64 (y en otras arquitecturas con la escalar).
+*/
+enum NucleoParticion {
+  PARTICION_ESCALAR,
+  PARTICION_AVX2,
+  PARTICION_AVX512,
+  NUM_NUCLEOS
+};
+
+
+/**
+   @brief Separa los elementos de un vector menores que un pivote.
+
+   @param T: vector de elementos. Tiene un número de elementos
+                   mayor o igual a final. Es MODIFICADO.
+   @param inicial: Posición que marca el incio del tramo.
+   @param final: Posición detrás de la última del tramo.
+		   inicial <= final.
+   @param pivote: valor con el que se compara.
+   @param iguales: si es true, los iguales al pivote van con los menores.
+   @return posición m tal que [inicial, m) contiene los menores que el
+           pivote (o no mayores, si iguales) y [m, final) el resto.
+
+   No es estable. Usa el núcleo elegido con fijar_nucleo_particion o,
+   si no se ha elegido ninguno, el detectado al arrancar.
+*/
+Indice particion_vectorial(float T[], Indice inicial, Indice final, float pivote,
+                        bool iguales);
+
+
+/**
+   @brief Núcleo con el que trabaja particion_vectorial.
+*/
+NucleoParticion nucleo_particion();
+
+
+/**
+   @brief Indica si el procesador y el sistema ofrecen el núcleo n.
+*/
+bool nucleo_disponible(NucleoParticion n);
+
+
+/**
+   @brief Elige el núcleo de particion_vectorial.
+   @return false, sin cambiar de núcleo, si n no está disponible.
+*/
+bool fijar_nucleo_particion(NucleoParticion n);
+
+
+const char * nombre_nucleo(NucleoParticion n);
+
+
+#endif
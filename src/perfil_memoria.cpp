@@ -0,0 +1,331 @@
+/**
+   @file perfil_memoria.cpp
+   @brief Reservas de memoria dinámica, pico de memoria y fallos de página por ejecución.
+   @date 2026-10-17
+
+   Los operator new y delete de este fichero sustituyen a los de la
+   biblioteca estándar en todo el programa. Reservan con malloc, como
+   los originales, y anotan cada bloque en los contadores del hilo que
+   lo reserva o libera. Los contadores del proceso, que son atómicos y
+   compartidos, sólo se actualizan mientras algún perfil de
+   MEMORIA_PROCESO está midiendo.
+*/
+
+
+#include "perfil_memoria.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <string>
+
+#include <sys/resource.h>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#define TAMANIO_BLOQUE(p) ((long long) malloc_usable_size(p))
+#else
+#define TAMANIO_BLOQUE(p) 0LL
+#endif
+
+
+/* ************************************************************ */
+/*  Contadores de reservas  */
+
+struct Cuenta {
+  long long reservas;
+  long long bytes;
+  long long vivos;
+  long long pico;
+};
+
+/**
+   Sin constructor, para que no haga falta reservar nada al crear un hilo.
+**/
+static thread_local Cuenta hilo;
+
+static std::atomic<long long> reservas_proceso(0);
+static std::atomic<long long> bytes_proceso(0);
+static std::atomic<long long> vivos_proceso(0);
+static std::atomic<long long> pico_proceso(0);
+static std::atomic<int> midiendo_proceso(0);
+
+
+static inline void contar_reserva(size_t n, long long real)
+{
+  hilo.reservas++;
+  hilo.bytes += n;
+  hilo.vivos += real;
+  if (hilo.vivos > hilo.pico)
+    hilo.pico = hilo.vivos;
+
+  if (midiendo_proceso.load(std::memory_order_relaxed) == 0)
+    return;
+  reservas_proceso++;
+  bytes_proceso += n;
+  long long vivos = vivos_proceso += real;
+  long long pico = pico_proceso.load(std::memory_order_relaxed);
+  while (vivos > pico && !pico_proceso.compare_exchange_weak(pico, vivos))
+    ;
+}
+
+
+static inline void contar_liberacion(long long real)
+{
+  hilo.vivos -= real;
+  if (midiendo_proceso.load(std::memory_order_relaxed) != 0)
+    vivos_proceso -= real;
+}
+
+
+void anotar_reserva(size_t bytes)
+{
+  contar_reserva(bytes, bytes);
+}
+
+
+void anotar_liberacion(size_t bytes)
+{
+  contar_liberacion(bytes);
+}
+
+
+static void * reservar(size_t n)
+{
+  void * p = malloc(n ? n : 1);
+  if (p)
+    contar_reserva(n, TAMANIO_BLOQUE(p));
+  return p;
+}
+
+
+static void liberar(void * p)
+{
+  if (p) {
+    contar_liberacion(TAMANIO_BLOQUE(p));
+    free(p);
+  }
+}
+
+
+void * operator new(size_t n)
+{
+  void * p = reservar(n);
+  if (p == NULL)
+    throw std::bad_alloc();
+  return p;
+}
+
+void * operator new[](size_t n)
+{
+  return operator new(n);
+}
+
+void * operator new(size_t n, const std::nothrow_t &) noexcept
+{
+  return reservar(n);
+}
+
+void * operator new[](size_t n, const std::nothrow_t &) noexcept
+{
+  return reservar(n);
+}
+
+void operator delete(void * p) noexcept { liberar(p); }
+void operator delete[](void * p) noexcept { liberar(p); }
+void operator delete(void * p, size_t) noexcept { liberar(p); }
+void operator delete[](void * p, size_t) noexcept { liberar(p); }
+void operator delete(void * p, const std::nothrow_t &) noexcept { liberar(p); }
+void operator delete[](void * p, const std::nothrow_t &) noexcept { liberar(p); }
+
+
+#ifdef __cpp_aligned_new
+
+static void * reservar_alineado(size_t n, std::align_val_t a)
+{
+  size_t alineacion = std::max((size_t) a, sizeof(void *));
+  void * p = aligned_alloc(alineacion, (n + alineacion - 1) / alineacion * alineacion);
+  if (p)
+    contar_reserva(n, TAMANIO_BLOQUE(p));
+  return p;
+}
+
+void * operator new(size_t n, std::align_val_t a)
+{
+  void * p = reservar_alineado(n, a);
+  if (p == NULL)
+    throw std::bad_alloc();
+  return p;
+}
+
+void * operator new[](size_t n, std::align_val_t a)
+{
+  return operator new(n, a);
+}
+
+void * operator new(size_t n, std::align_val_t a, const std::nothrow_t &) noexcept
+{
+  return reservar_alineado(n, a);
+}
+
+void * operator new[](size_t n, std::align_val_t a, const std::nothrow_t &) noexcept
+{
+  return reservar_alineado(n, a);
+}
+
+void operator delete(void * p, std::align_val_t) noexcept { liberar(p); }
+void operator delete[](void * p, std::align_val_t) noexcept { liberar(p); }
+void operator delete(void * p, size_t, std::align_val_t) noexcept { liberar(p); }
+void operator delete[](void * p, size_t, std::align_val_t) noexcept { liberar(p); }
+void operator delete(void * p, std::align_val_t, const std::nothrow_t &) noexcept
+{
+  liberar(p);
+}
+void operator delete[](void * p, std::align_val_t, const std::nothrow_t &) noexcept
+{
+  liberar(p);
+}
+
+#endif
+
+
+/* ************************************************************ */
+/*  Memoria residente  */
+
+/**
+   @brief Pone a cero el pico de memoria residente del proceso (VmHWM).
+   @return false si el núcleo no lo permite (anterior a Linux 4.0).
+*/
+static bool borrar_pico_rss()
+{
+  FILE * f = fopen("/proc/self/clear_refs", "w");
+  if (f == NULL)
+    return false;
+  bool bien = fputs("5", f) >= 0;
+  return fclose(f) == 0 && bien;
+}
+
+
+/**
+   @brief Pico de memoria residente del proceso en KiB, o -1.
+*/
+static long long pico_rss()
+{
+  std::ifstream f("/proc/self/status");
+  std::string linea;
+  while (getline(f, linea))
+    if (linea.compare(0, 6, "VmHWM:") == 0)
+      return atoll(linea.c_str() + 6);
+  return -1;
+}
+
+
+/* ************************************************************ */
+/*  PerfilMemoria  */
+
+PerfilMemoria::PerfilMemoria(AmbitoMemoria ambito, bool rss)
+  : ambito(ambito), rss(rss)
+{
+  reiniciar();
+}
+
+
+PerfilMemoria::~PerfilMemoria()
+{
+}
+
+
+void PerfilMemoria::reiniciar()
+{
+  std::fill(acumulado, acumulado + NUM_MEDIDAS_MEMORIA, 0.0);
+  ejecuciones = 0;
+}
+
+
+void PerfilMemoria::iniciar()
+{
+  struct rusage r;
+  if (ambito == MEMORIA_PROCESO) {
+    midiendo_proceso++;
+    pico_proceso = vivos_proceso.load();
+    inicio[RESERVAS] = reservas_proceso;
+    inicio[BYTES_RESERVADOS] = bytes_proceso;
+    inicio[PICO_EXTRA] = vivos_proceso;
+    getrusage(RUSAGE_SELF, &r);
+  } else {
+    hilo.pico = hilo.vivos;
+    inicio[RESERVAS] = hilo.reservas;
+    inicio[BYTES_RESERVADOS] = hilo.bytes;
+    inicio[PICO_EXTRA] = hilo.vivos;
+    getrusage(RUSAGE_THREAD, &r);
+  }
+  inicio[FALLOS_MENORES] = r.ru_minflt;
+  inicio[FALLOS_MAYORES] = r.ru_majflt;
+  if (rss && !borrar_pico_rss())
+    rss = false;
+}
+
+
+void PerfilMemoria::detener()
+{
+  double fin[NUM_MEDIDAS_MEMORIA];
+  struct rusage r;
+  if (ambito == MEMORIA_PROCESO) {
+    fin[RESERVAS] = reservas_proceso;
+    fin[BYTES_RESERVADOS] = bytes_proceso;
+    fin[PICO_EXTRA] = pico_proceso;
+    midiendo_proceso--;
+    getrusage(RUSAGE_SELF, &r);
+  } else {
+    fin[RESERVAS] = hilo.reservas;
+    fin[BYTES_RESERVADOS] = hilo.bytes;
+    fin[PICO_EXTRA] = hilo.pico;
+    getrusage(RUSAGE_THREAD, &r);
+  }
+  fin[FALLOS_MENORES] = r.ru_minflt;
+  fin[FALLOS_MAYORES] = r.ru_majflt;
+
+  acumulado[RESERVAS] += fin[RESERVAS] - inicio[RESERVAS];
+  acumulado[BYTES_RESERVADOS] += fin[BYTES_RESERVADOS] - inicio[BYTES_RESERVADOS];
+  acumulado[PICO_EXTRA] = std::max(acumulado[PICO_EXTRA],
+                                   fin[PICO_EXTRA] - inicio[PICO_EXTRA]);
+  acumulado[FALLOS_MENORES] += fin[FALLOS_MENORES] - inicio[FALLOS_MENORES];
+  acumulado[FALLOS_MAYORES] += fin[FALLOS_MAYORES] - inicio[FALLOS_MAYORES];
+  if (rss)
+    acumulado[RSS_PICO] = std::max(acumulado[RSS_PICO], (double) pico_rss());
+  ejecuciones++;
+}
+
+
+bool PerfilMemoria::disponible(MedidaMemoria m) const
+{
+  switch (m) {
+  case RSS_PICO:   return rss;
+#ifndef __GLIBC__
+  case PICO_EXTRA: return false;
+#endif
+  default:         return true;
+  }
+}
+
+
+double PerfilMemoria::valor(MedidaMemoria m) const
+{
+  if (m == PICO_EXTRA || m == RSS_PICO || ejecuciones == 0)
+    return acumulado[m];
+  return acumulado[m] / ejecuciones;
+}
+
+
+const char * PerfilMemoria::nombre(MedidaMemoria m)
+{
+  static const char * NOMBRES[NUM_MEDIDAS_MEMORIA] = {
+    "reservas", "bytes_reservados", "pico_extra", "fallos_menores",
+    "fallos_mayores", "rss_pico_kib"
+  };
+  return NOMBRES[m];
+}
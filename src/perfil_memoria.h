@@ -0,0 +1,115 @@
+/**
+   @file perfil_memoria.h
+   @brief Reservas de memoria dinámica, pico de memoria y fallos de página por ejecución.
+   @date 2026-10-17
+*/
+
+#ifndef PERFIL_MEMORIA_H
+#define PERFIL_MEMORIA_H
+
+#include <cstddef>
+
+
+/**
+   @brief Medidas de memoria de una ejecución.
+*/
+enum MedidaMemoria {
+  RESERVAS,               ///< Llamadas a operator new.
+  BYTES_RESERVADOS,       ///< Bytes pedidos a operator new.
+  PICO_EXTRA,             ///< Máximo de bytes reservados vivos a la vez.
+  FALLOS_MENORES,         ///< Fallos de página resueltos sin disco.
+  FALLOS_MAYORES,         ///< Fallos de página que han leído del disco.
+  RSS_PICO,               ///< Pico de memoria residente del proceso (KiB).
+  NUM_MEDIDAS_MEMORIA
+};
+
+
+/**
+   @brief Qué reservas y fallos de página se atribuyen a la ejecución.
+*/
+enum AmbitoMemoria {
+  MEMORIA_HILO,           ///< Sólo los del hilo que la mide.
+  MEMORIA_PROCESO         ///< Los de todos los hilos (algoritmos paralelos).
+};
+
+
+/**
+   @brief Perfil de memoria de las ejecuciones de un algoritmo.
+
+   perfil_memoria.cpp sustituye los operator new y delete globales para
+   contar las reservas de cada hilo y, mientras haya un perfil de
+   MEMORIA_PROCESO midiendo, las de todo el proceso. Los bytes vivos se
+   cuentan con el tamaño real de cada bloque (malloc_usable_size), así
+   que PICO_EXTRA incluye el redondeo de malloc. Lo reservado antes de
+   iniciar(), como el propio vector a ordenar, no cuenta. Las reservas
+   que no pasan por operator new, como las de una Arena, se anotan con
+   anotar_reserva y anotar_liberacion.
+
+   RESERVAS, BYTES_RESERVADOS y los fallos de página son medias por
+   ejecución; PICO_EXTRA y RSS_PICO, el máximo de todas. RSS_PICO es de
+   todo el proceso: se pone a cero escribiendo en /proc/self/clear_refs
+   y se lee de VmHWM en /proc/self/status, así que sólo tiene sentido si
+   no mide nadie más a la vez.
+*/
+class PerfilMemoria {
+public:
+  /**
+     @param ambito: hilos cuyas reservas y fallos se cuentan.
+     @param rss: si se mide RSS_PICO.
+  */
+  explicit PerfilMemoria(AmbitoMemoria ambito = MEMORIA_HILO, bool rss = true);
+  ~PerfilMemoria();
+
+  /**
+     @brief Empieza a medir una ejecución.
+  */
+  void iniciar();
+
+  /**
+     @brief Termina de medir la ejecución y la suma a las anteriores.
+  */
+  void detener();
+
+  /**
+     @brief Borra las ejecuciones medidas.
+  */
+  void reiniciar();
+
+  /**
+     @brief Indica si la medida m está disponible.
+  */
+  bool disponible(MedidaMemoria m) const;
+
+  /**
+     @brief Valor de la medida m desde el último reiniciar().
+  */
+  double valor(MedidaMemoria m) const;
+
+  static const char * nombre(MedidaMemoria m);
+
+private:
+  AmbitoMemoria ambito;
+  bool rss;
+  double acumulado[NUM_MEDIDAS_MEMORIA];
+  double inicio[NUM_MEDIDAS_MEMORIA];
+  int ejecuciones;
+
+  PerfilMemoria(const PerfilMemoria &);
+  PerfilMemoria & operator=(const PerfilMemoria &);
+};
+
+
+/**
+   @brief Anota en el hilo actual una reserva de bytes bytes hecha sin
+   operator new, como las de una Arena.
+*/
+void anotar_reserva(size_t bytes);
+
+/**
+   @brief Anota en el hilo actual la liberación de bytes bytes anotados
+   con anotar_reserva.
+*/
+void anotar_liberacion(size_t bytes);
+
+
+#endif
@@ -0,0 +1,125 @@
+/**
+   @file planificador.cpp
+   @brief Conjunto de hilos con robo de tareas para los algoritmos paralelos.
+   @date 2026-10-17
+*/
+
+
+#include "planificador.h"
+
+
+/**
+   Planificador al que pertenece el hilo actual y su cola en él.
+   Los hilos ajenos al planificador (el que lo crea) usan la cola 0.
+**/
+static thread_local const Planificador * planificador_propio = NULL;
+static thread_local int cola_propia = 0;
+
+
+Planificador::Planificador(int num_hilos)
+  : num_hilos(num_hilos < 1 ? 1 : num_hilos), pendientes(0), terminar(false)
+{
+  for (int i = 0; i < this->num_hilos; i++)
+    colas.push_back(new Cola);
+  for (int i = 1; i < this->num_hilos; i++)
+    trabajadores.push_back(std::thread(&Planificador::bucle_trabajador, this, i));
+}
+
+
+Planificador::~Planificador()
+{
+  {
+    std::lock_guard<std::mutex> l(m_espera);
+    terminar = true;
+  }
+  hay_tareas.notify_all();
+  for (size_t i = 0; i < trabajadores.size(); i++)
+    trabajadores[i].join();
+  for (size_t i = 0; i < colas.size(); i++)
+    delete colas[i];
+}
+
+
+int Planificador::cola_actual() const
+{
+  return planificador_propio == this ? cola_propia : 0;
+}
+
+
+void Planificador::lanzar(GrupoTareas & g, std::function<void()> tarea)
+{
+  g.pendientes++;
+  pendientes++;
+  Cola & c = *colas[cola_actual()];
+  {
+    std::lock_guard<std::mutex> l(c.m);
+    c.tareas.push_back(Tarea{ tarea, &g });
+  }
+  {
+    std::lock_guard<std::mutex> l(m_espera);
+  }
+  hay_tareas.notify_one();
+}
+
+
+bool Planificador::ejecutar_una(int propia)
+{
+  Tarea t;
+  bool encontrada = false;
+
+  // Primero la última tarea de la cola propia
+  {
+    Cola & c = *colas[propia];
+    std::lock_guard<std::mutex> l(c.m);
+    if (!c.tareas.empty()) {
+      t = c.tareas.back();
+      c.tareas.pop_back();
+      encontrada = true;
+    }
+  }
+
+  // Si no hay, la más antigua de otra cola
+  for (int i = 1; i < num_hilos && !encontrada; i++) {
+    Cola & c = *colas[(propia + i) % num_hilos];
+    std::lock_guard<std::mutex> l(c.m);
+    if (!c.tareas.empty()) {
+      t = c.tareas.front();
+      c.tareas.pop_front();
+      encontrada = true;
+    }
+  }
+
+  if (!encontrada)
+    return false;
+
+  pendientes--;
+  t.funcion();
+  t.grupo->pendientes--;
+  return true;
+}
+
+
+void Planificador::esperar(GrupoTareas & g)
+{
+  int propia = cola_actual();
+  while (g.pendientes > 0)
+    if (!ejecutar_una(propia))
+      std::this_thread::yield();
+}
+
+
+void Planificador::bucle_trabajador(int indice)
+{
+  planificador_propio = this;
+  cola_propia = indice;
+
+  while (true) {
+    if (ejecutar_una(indice))
+      continue;
+
+    std::unique_lock<std::mutex> l(m_espera);
+    hay_tareas.wait(l, [this]() { return pendientes > 0 || terminar; });
+    if (terminar)
+      return;
+  }
+}
@@ -0,0 +1,96 @@
+/**
+   @file planificador.h
+   @brief Conjunto de hilos con robo de tareas para los algoritmos paralelos.
+   @date 2026-10-17
+*/
+
+#ifndef PLANIFICADOR_H
+#define PLANIFICADOR_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/**
+   @brief Conjunto de tareas lanzadas juntas y esperadas juntas.
+*/
+class GrupoTareas {
+public:
+  GrupoTareas() : pendientes(0) {}
+
+private:
+  std::atomic<int> pendientes;
+
+  friend class Planificador;
+};
+
+
+/**
+   @brief Planificador de tareas con robo de trabajo.
+
+   Cada hilo tiene su propia cola doble: añade y toma tareas por el
+   final (la última lanzada, la más caliente en caché) y, cuando se
+   queda sin trabajo, roba por el principio de la cola de otro hilo
+   (la más antigua, que en los algoritmos recursivos es la más grande).
+
+   El hilo que crea el planificador cuenta como uno de los num_hilos:
+   mientras espera a un grupo ejecuta tareas en lugar de bloquearse,
+   así que las tareas pueden lanzar y esperar subtareas sin riesgo de
+   interbloqueo.
+*/
+class Planificador {
+public:
+  /**
+     @brief Crea el planificador con num_hilos hilos en total.
+     @param num_hilos: número de hilos, incluido el que lo crea.
+                       Si es menor que 1 se usa 1.
+  */
+  explicit Planificador(int num_hilos);
+  ~Planificador();
+
+  int hilos() const { return num_hilos; }
+
+  /**
+     @brief Añade una tarea al grupo g en la cola del hilo actual.
+  */
+  void lanzar(GrupoTareas & g, std::function<void()> tarea);
+
+  /**
+     @brief Ejecuta tareas hasta que terminan todas las del grupo g.
+  */
+  void esperar(GrupoTareas & g);
+
+private:
+  struct Tarea {
+    std::function<void()> funcion;
+    GrupoTareas * grupo;
+  };
+
+  struct Cola {
+    std::mutex m;
+    std::deque<Tarea> tareas;
+  };
+
+  int num_hilos;
+  std::vector<Cola *> colas;
+  std::vector<std::thread> trabajadores;
+  std::atomic<int> pendientes;
+  std::atomic<bool> terminar;
+  std::mutex m_espera;
+  std::condition_variable hay_tareas;
+
+  int cola_actual() const;
+  bool ejecutar_una(int propia);
+  void bucle_trabajador(int indice);
+
+  Planificador(const Planificador &);
+  Planificador & operator=(const Planificador &);
+};
+
+
+#endif
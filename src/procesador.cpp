@@ -0,0 +1,243 @@
+/**
+   @file procesador.cpp
+   @brief Topología, afinidad, frecuencia y ruido de los núcleos del procesador.
+   @date 2026-10-17
+
+   Todo se lee de /sys/devices/system/cpu y /proc/stat. Lo que no
+   existe (cpufreq en máquinas virtuales, la topología en contenedores
+   antiguos, cualquier cosa fuera de Linux) se trata como desconocido y
+   no impide medir.
+*/
+
+
+#include "procesador.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <utility>
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+using std::string;
+using std::vector;
+
+
+/**
+   @brief Lee la primera línea de un fichero de /sys.
+   @return false si no existe o está vacío.
+*/
+static bool leer_sys(const string & ruta, string & valor)
+{
+  std::ifstream f(ruta.c_str());
+  return f && getline(f, valor) && !valor.empty();
+}
+
+
+static string ruta_cpu(int cpu, const char * fichero)
+{
+  std::ostringstream ss;
+  ss << "/sys/devices/system/cpu/cpu" << cpu << "/" << fichero;
+  return ss.str();
+}
+
+
+#ifdef __linux__
+
+/**
+   Máscara de afinidad del proceso al empezar, antes de fijar ningún hilo.
+**/
+static cpu_set_t mascara_inicial()
+{
+  cpu_set_t m;
+  CPU_ZERO(&m);
+  if (sched_getaffinity(0, sizeof(m), &m) != 0)
+    for (int c = 0; c < CPU_SETSIZE; c++)
+      CPU_SET(c, &m);
+  return m;
+}
+
+static const cpu_set_t MASCARA_INICIAL = mascara_inicial();
+
+#endif
+
+
+vector<NucleoFisico> nucleos_fisicos()
+{
+  vector<NucleoFisico> nucleos;
+#ifdef __linux__
+  // (paquete, core_id) -> posición en nucleos
+  std::map<std::pair<int, int>, size_t> indice;
+  for (int c = 0; c < CPU_SETSIZE; c++) {
+    if (!CPU_ISSET(c, &MASCARA_INICIAL))
+      continue;
+    string paquete, nucleo;
+    std::pair<int, int> clave(-1, c);
+    if (leer_sys(ruta_cpu(c, "topology/physical_package_id"), paquete) &&
+        leer_sys(ruta_cpu(c, "topology/core_id"), nucleo))
+      clave = std::make_pair(atoi(paquete.c_str()), atoi(nucleo.c_str()));
+
+    std::map<std::pair<int, int>, size_t>::iterator it = indice.find(clave);
+    if (it == indice.end()) {
+      indice[clave] = nucleos.size();
+      NucleoFisico n;
+      n.cpu = c;
+      n.hermanos.push_back(c);
+      nucleos.push_back(n);
+    } else {
+      nucleos[it->second].hermanos.push_back(c);
+    }
+  }
+
+  if (nucleos.size() > 1 && nucleos[0].cpu == 0)
+    std::rotate(nucleos.begin(), nucleos.begin() + 1, nucleos.end());
+#else
+  NucleoFisico n;
+  n.cpu = 0;
+  n.hermanos.push_back(0);
+  nucleos.push_back(n);
+#endif
+  return nucleos;
+}
+
+
+bool fijar_hilo(int cpu)
+{
+#ifdef __linux__
+  cpu_set_t m;
+  CPU_ZERO(&m);
+  CPU_SET(cpu, &m);
+  return sched_setaffinity(0, sizeof(m), &m) == 0;
+#else
+  (void) cpu;
+  return false;
+#endif
+}
+
+
+void liberar_hilo()
+{
+#ifdef __linux__
+  sched_setaffinity(0, sizeof(MASCARA_INICIAL), &MASCARA_INICIAL);
+#endif
+}
+
+
+double frecuencia_mhz(int cpu)
+{
+  string valor;
+  if (!leer_sys(ruta_cpu(cpu, "cpufreq/scaling_cur_freq"), valor))
+    return 0;
+  return atof(valor.c_str()) / 1000;
+}
+
+
+string gobernador(int cpu)
+{
+  string valor;
+  if (!leer_sys(ruta_cpu(cpu, "cpufreq/scaling_governor"), valor))
+    return "-";
+  return valor;
+}
+
+
+size_t memoria_disponible()
+{
+  size_t disponible = 0;
+  std::ifstream f("/proc/meminfo");
+  string linea;
+  while (getline(f, linea))
+    if (linea.compare(0, 13, "MemAvailable:") == 0)
+      disponible = (size_t) atoll(linea.c_str() + 13) << 10;
+
+  // cgroup v2: "max" si no hay límite
+  string limite, uso;
+  if (leer_sys("/sys/fs/cgroup/memory.max", limite) && isdigit(limite[0]) &&
+      leer_sys("/sys/fs/cgroup/memory.current", uso)) {
+    size_t l = strtoull(limite.c_str(), NULL, 10);
+    size_t u = strtoull(uso.c_str(), NULL, 10);
+    size_t resto = l > u ? l - u : 0;
+    if (disponible == 0 || resto < disponible)
+      disponible = resto;
+  }
+  return disponible;
+}
+
+
+Instantanea instantanea()
+{
+  Instantanea s;
+  s.involuntarios = 0;
+  s.segundos = std::chrono::duration<double>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+
+  // cpuN usuario nice sistema ocioso espera irq softirq robado ...
+  std::ifstream f("/proc/stat");
+  string linea;
+  while (getline(f, linea)) {
+    // La primera línea, "cpu ...", es la suma de todas
+    if (linea.compare(0, 3, "cpu") != 0 || !isdigit((unsigned char) linea[3]))
+      continue;
+    int cpu = atoi(linea.c_str() + 3);
+    std::istringstream ss(linea.substr(linea.find(' ')));
+    uint64_t v, total = 0, ocioso = 0;
+    for (int campo = 0; ss >> v; campo++) {
+      // guest y guest_nice ya están incluidos en usuario y nice
+      if (campo >= 8)
+        break;
+      total += v;
+      if (campo == 3 || campo == 4)
+        ocioso += v;
+    }
+    if ((int) s.total.size() <= cpu) {
+      s.total.resize(cpu + 1, 0);
+      s.ocupado.resize(cpu + 1, 0);
+    }
+    s.total[cpu] = total;
+    s.ocupado[cpu] = total - ocioso;
+  }
+
+#if defined(__linux__) && defined(RUSAGE_THREAD)
+  struct rusage r;
+  if (getrusage(RUSAGE_THREAD, &r) == 0)
+    s.involuntarios = r.ru_nivcsw;
+#endif
+  return s;
+}
+
+
+Ruido comparar(const Instantanea & antes, const Instantanea & despues,
+               const vector<bool> & reservadas,
+               double mhz_inicio, double mhz_fin)
+{
+  Ruido r;
+  r.mhz_inicio = mhz_inicio;
+  r.mhz_fin = mhz_fin;
+  r.involuntarios = despues.involuntarios - antes.involuntarios;
+
+  uint64_t ocupado = 0, total = 0;
+  size_t n = std::min(antes.total.size(), despues.total.size());
+  for (size_t c = 0; c < n; c++) {
+    if (c < reservadas.size() && reservadas[c])
+      continue;
+    ocupado += despues.ocupado[c] - antes.ocupado[c];
+    total += despues.total[c] - antes.total[c];
+  }
+  r.ocupacion_ajena = total > 0 ? (double) ocupado / total : 0;
+
+  double segundos = despues.segundos - antes.segundos;
+  bool variacion = mhz_inicio > 0 && mhz_fin > 0 &&
+    std::max(mhz_inicio, mhz_fin) > (1 + VARIACION_FRECUENCIA_RUIDO) *
+                                    std::min(mhz_inicio, mhz_fin);
+  r.ruidoso = variacion || r.ocupacion_ajena > OCUPACION_AJENA_RUIDO ||
+              (segundos > 0 && r.involuntarios > INVOLUNTARIOS_RUIDO * segundos);
+  return r;
+}
@@ -0,0 +1,137 @@
+/**
+   @file procesador.h
+   @brief Topología, afinidad, frecuencia y ruido de los núcleos del procesador.
+   @date 2026-10-17
+*/
+
+#ifndef PROCESADOR_H
+#define PROCESADOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+/**
+   @brief Núcleo físico en el que puede ejecutarse el proceso.
+*/
+struct NucleoFisico {
+  int cpu;                      ///< CPU lógica en la que se fijan los hilos.
+  std::vector<int> hermanos;    ///< Todas sus CPU lógicas (SMT), cpu incluida.
+};
+
+
+/**
+   @brief Núcleos físicos de la máscara de afinidad del proceso.
+
+   Agrupa las CPU lógicas permitidas por paquete y core_id de
+   /sys/devices/system/cpu y devuelve un núcleo por grupo, usando la
+   CPU lógica menor de cada uno. Si la topología no está disponible,
+   cada CPU lógica cuenta como un núcleo. Si hay más de un núcleo, el
+   que contiene la CPU 0, que atiende la mayoría de las interrupciones,
+   va el último.
+*/
+std::vector<NucleoFisico> nucleos_fisicos();
+
+
+/**
+   @brief Fija el hilo actual a la CPU lógica cpu.
+   @return false si sched_setaffinity falla.
+*/
+bool fijar_hilo(int cpu);
+
+
+/**
+   @brief Devuelve el hilo actual a la máscara de afinidad inicial del
+   proceso.
+*/
+void liberar_hilo();
+
+
+/**
+   @brief Frecuencia actual de la CPU lógica cpu en MHz, o 0 si no se
+   conoce (sin cpufreq, como en muchas máquinas virtuales).
+*/
+double frecuencia_mhz(int cpu);
+
+
+/**
+   @brief Gobernador de frecuencia de la CPU lógica cpu, o "-" si no se
+   conoce.
+*/
+std::string gobernador(int cpu);
+
+
+/**
+   @brief Bytes que el proceso puede reservar sin que el sistema tenga
+   que desalojar páginas ni matarlo, o 0 si no se conoce.
+
+   Es MemAvailable de /proc/meminfo o, si el proceso está en un cgroup
+   con límite de memoria, lo que le quede hasta ese límite, si es menor.
+*/
+size_t memoria_disponible();
+
+
+/**
+   @brief Instantánea del tiempo de CPU de cada CPU lógica y de los
+   cambios de contexto del hilo actual.
+*/
+struct Instantanea {
+  std::vector<uint64_t> ocupado;   ///< Ticks no ociosos de cada CPU lógica.
+  std::vector<uint64_t> total;     ///< Ticks totales de cada CPU lógica.
+  long involuntarios;              ///< Cambios de contexto involuntarios.
+  double segundos;                 ///< Instante de steady_clock.
+};
+
+/**
+   @brief Toma una instantánea de /proc/stat y de getrusage(RUSAGE_THREAD).
+*/
+Instantanea instantanea();
+
+
+/**
+   @brief Estado del procesador durante la medición de un punto.
+*/
+struct Ruido {
+  double mhz_inicio;        ///< Frecuencia de la CPU al empezar (0 si no se conoce).
+  double mhz_fin;           ///< Frecuencia de la CPU al terminar.
+  long involuntarios;       ///< Veces que se quitó la CPU al hilo medidor.
+  double ocupacion_ajena;   ///< Ocupación media de las CPU no reservadas.
+  bool ruidoso;
+};
+
+
+/**
+   @brief Umbrales a partir de los que un punto se marca como ruidoso.
+**/
+const double INVOLUNTARIOS_RUIDO = 10.0;        ///< Por segundo.
+const double VARIACION_FRECUENCIA_RUIDO = 0.05;
+const double OCUPACION_AJENA_RUIDO = 0.25;
+
+
+/**
+   @brief Compara dos instantáneas tomadas por el hilo medidor antes y
+   después de medir un punto.
+
+   @param antes: instantánea al empezar.
+   @param despues: instantánea al terminar.
+   @param reservadas: CPU lógicas en las que miden los hilos del
+                      barrido, que no cuentan como ocupación ajena. Sus
+                      hermanas SMT sí cuentan: comparten el núcleo.
+   @param mhz_inicio: frecuencia de la CPU del hilo al empezar.
+   @param mhz_fin: frecuencia de la CPU del hilo al terminar.
+
+   El punto es ruidoso si el hilo perdió la CPU de forma involuntaria
+   más de INVOLUNTARIOS_RUIDO veces por segundo (los hilos del núcleo
+   lo hacen de vez en cuando incluso en una máquina en reposo), si la
+   frecuencia varió más de VARIACION_FRECUENCIA_RUIDO o si las CPU
+   ajenas al barrido estuvieron ocupadas más de OCUPACION_AJENA_RUIDO
+   del tiempo (otros procesos que compiten por la caché y la memoria).
+*/
+Ruido comparar(const Instantanea & antes, const Instantanea & despues,
+               const std::vector<bool> & reservadas,
+               double mhz_inicio, double mhz_fin);
+
+
+#endif
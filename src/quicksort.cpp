@@ -1,241 +0,0 @@
-/**
-   @file quicksort.cpp
-   @brief Ordenación rápida (quicksort).
-   @date 2023-3-6
-*/
-
-   
-#include <iostream>
-#include <ctime>
-#include <cstdlib>
-#include <climits>
-#include <cassert>
-#include <chrono>
-
-using std::cout;
-using std::cerr;
-using std::endl;
-using namespace std::chrono;
-
-
-/* ************************************************************ */ 
-/*  Método de ordenación rápida  */
-
-/**
-   @brief Ordena un vector por el método quicksort.
-
-   @param T: vector de elementos. Debe tener num_elem elementos.
-             Es MODIFICADO.
-   @param num_elem: número de elementos. num_elem > 0.
-
-   Cambia el orden de los elementos de T de forma que los dispone
-   en sentido creciente de menor a mayor.
-   Aplica el algoritmo quicksort.
-*/
-inline static 
-void quicksort(float T[], int num_elem);
-
-
-
-/**
-   @brief Ordena parte de un vector por el método quicksort.
-
-   @param T: vector de elementos. Tiene un número de elementos 
-                   mayor o igual a final. Es MODIFICADO.
-   @param inicial: Posición que marca el incio de la parte del
-                   vector a ordenar.
-   @param final: Posición detrás de la última de la parte del
-                   vector a ordenar. 
-		   inicial < final.
-
-   Cambia el orden de los elementos de T entre las posiciones
-   inicial y final - 1 de forma que los dispone en sentido creciente
-   de menor a mayor.
-   Aplica el algoritmo quicksort.
-*/
-static void quicksort_lims(float T[], int inicial, int final);
-
-
-/**
-   @brief Ordena un vector por el método de inserción.
-
-   @param T: vector de elementos. Debe tener num_elem elementos.
-             Es MODIFICADO.
-   @param num_elem: número de elementos. num_elem > 0.
-
-   Cambia el orden de los elementos de T de forma que los dispone
-   en sentido creciente de menor a mayor.
-   Aplica el algoritmo de inserción.
-*/
-inline static 
-void insercion(float T[], int num_elem);
-
-
-/**
-   @brief Ordena parte de un vector por el método de inserción.
-
-   @param T: vector de elementos. Tiene un número de elementos 
-                   mayor o igual a final. Es MODIFICADO.
-   @param inicial: Posición que marca el incio de la parte del
-                   vector a ordenar.
-   @param final: Posición detrás de la última de la parte del
-                   vector a ordenar. 
-		   inicial < final.
-
-   Cambia el orden de los elementos de T entre las posiciones
-   inicial y final - 1 de forma que los dispone en sentido creciente
-   de menor a mayor.
-   Aplica el algoritmo de inserción.
-*/
-static void insercion_lims(float T[], int inicial, int final);
-
-
-/**
-   @brief Redistribuye los elementos de un vector según un pivote.
-
-   @param T: vector de elementos. Tiene un número de elementos 
-                   mayor o igual a final. Es MODIFICADO.
-   @param inicial: Posición que marca el incio de la parte del
-                   vector a ordenar.
-   @param final: Posición detrás de la última de la parte del
-                   vector a ordenar. 
-		   inicial < final.
-   @param pp: Posición del pivote. Es MODIFICADO.
-
-   Selecciona un pivote los elementos de T situados en las posiciones
-   entre inicial y final - 1. Redistribuye los elementos, situando los
-   menores que el pivote a su izquierda, después los iguales y a la
-   derecha los mayores. La posición del pivote se devuelve en pp.
-*/
-static void dividir_qs(float T[], int inicial, int final, int & pp);
-
-
-
-/**
-   Implementación de las funciones
-**/
-
-
-inline static void insercion(float T[], int num_elem)
-{
-  insercion_lims(T, 0, num_elem);
-}
-
-
-static void insercion_lims(float T[], int inicial, int final)
-{
-  int i, j;
-  int aux;
-  for (i = inicial + 1; i < final; i++) {
-    j = i;
-    while ((T[j] < T[j-1]) && (j > 0)) {
-      aux = T[j];
-      T[j] = T[j-1];
-      T[j-1] = aux;
-      j--;
-    };
-  };
-}
-
-
-const int UMBRAL_QS = 50;
-
-
-inline void quicksort(float T[], int num_elem)
-{
-  quicksort_lims(T, 0, num_elem);
-}
-
-static void quicksort_lims(float T[], int inicial, int final)
-{
-  int k;
-  if (final - inicial < UMBRAL_QS) {
-    insercion_lims(T, inicial, final);
-  } else {
-    dividir_qs(T, inicial, final, k);
-    quicksort_lims(T, inicial, k);
-    quicksort_lims(T, k + 1, final);
-  };
-}
-
-
-static void dividir_qs(float T[], int inicial, int final, int & pp)
-{
-  int pivote, aux;
-  int k, l;
-
-  pivote = T[inicial];
-  k = inicial;
-  l = final;
-  do {
-    k++;
-  } while ((T[k] <= pivote) && (k < final-1));
-  do {
-    l--;
-  } while (T[l] > pivote);
-  while (k < l) {
-    aux = T[k];
-    T[k] = T[l];
-    T[l] = aux;
-    do k++; while (T[k] <= pivote);
-    do l--; while (T[l] > pivote);
-  };
-  aux = T[inicial];
-  T[inicial] = T[l];
-  T[l] = aux;
-  pp = l;
-};
-
-
-
- 
-int main(int argc, char * argv[])
-{
-
-	if (argc != 3)
-    {
-		cerr << "Formato " << argv[0] << " <num_elem> <num_muestras>"<< endl;
-		return -1;
-    }
-
-	int tamanio_vector = atoi(argv[1]);
-	int num_muestras = atoi(argv[2]);
-
-	if (tamanio_vector <= 0)
-    {
-		cerr << "El tamaño del vector debe ser positivo" << endl;
-		return -1;
-    }
-
-	float * T = new float[tamanio_vector];
-	assert(T);
-
-	srandom(time(0));
-
-	// varibles que miden tiempos
-	high_resolution_clock::time_point t_antes, t_despues;
-	duration<double> acumulado = duration<double>::zero();
-
-	for(int n = 0; n < num_muestras; n++)
-	{
-		// Genero el vector desordenado
-		for (int i = 0; i < tamanio_vector; i++)
-		{
-			T[i] = random();
-		};
-
-		// Ejecuto y mido tiempos
-		t_antes = high_resolution_clock::now();
-
-		quicksort(T, tamanio_vector);
-
-		t_despues = high_resolution_clock::now();
-		acumulado += duration_cast<duration<double>>(t_despues - t_antes);
-	}
-
-	cout << acumulado.count() / num_muestras << endl;
-
-	delete [] T;
-
-	return 0;
-};
@@ -0,0 +1,316 @@
+/**
+   @file quicksort.h
+   @brief Ordenación rápida (quicksort).
+   @date 2023-3-6
+*/
+
+#ifndef QUICKSORT_H
+#define QUICKSORT_H
+
+#include "insercion.h"
+#include "heapsort.h"
+#include "umbrales.h"
+
+#include <functional>
+#include <algorithm>
+
+
+/* ************************************************************ */
+/*  Método de ordenación rápida  */
+
+/**
+   @brief Ordena un vector por el método quicksort.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   Cambia el orden de los elementos de T de forma que los dispone
+   en sentido creciente de menor a mayor según comp.
+   Aplica el algoritmo quicksort.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+inline void quicksort(Tipo T[], Indice num_elem, Comparador comp = Comparador());
+
+
+
+/**
+   @brief Ordena parte de un vector por el método quicksort.
+
+   @param T: vector de elementos. Tiene un número de elementos
+                   mayor o igual a final. Es MODIFICADO.
+   @param inicial: Posición que marca el incio de la parte del
+                   vector a ordenar.
+   @param final: Posición detrás de la última de la parte del
+                   vector a ordenar.
+		   inicial < final.
+   @param comp: orden estricto entre elementos.
+
+   Cambia el orden de los elementos de T entre las posiciones
+   inicial y final - 1 de forma que los dispone en sentido creciente
+   de menor a mayor según comp.
+   Aplica el algoritmo quicksort.
+*/
+template <class Tipo, class Comparador>
+void quicksort_lims(Tipo T[], Indice inicial, Indice final, Comparador comp);
+
+
+/**
+   @brief Redistribuye los elementos de un vector según un pivote.
+
+   @param T: vector de elementos. Tiene un número de elementos
+                   mayor o igual a final. Es MODIFICADO.
+   @param inicial: Posición que marca el incio de la parte del
+                   vector a ordenar.
+   @param final: Posición detrás de la última de la parte del
+                   vector a ordenar.
+		   inicial < final.
+   @param pp: Posición del pivote. Es MODIFICADO.
+   @param comp: orden estricto entre elementos.
+
+   Selecciona un pivote los elementos de T situados en las posiciones
+   entre inicial y final - 1. Redistribuye los elementos, situando los
+   menores que el pivote a su izquierda, después los iguales y a la
+   derecha los mayores. La posición del pivote se devuelve en pp.
+*/
+template <class Tipo, class Comparador>
+inline void dividir_qs(Tipo T[], Indice inicial, Indice final, Indice & pp,
+                       Comparador comp);
+
+
+/**
+   @brief Ordena un vector por quicksort con peor caso O(n log n).
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   Cambia el orden de los elementos de T de forma que los dispone
+   en sentido creciente de menor a mayor según comp.
+   Variante de quicksort (introsort) que elige el pivote con
+   elegir_pivote, divide con dividir_robusto, llama recursivamente
+   sólo sobre la parte menor e itera sobre la mayor, de modo que la
+   pila crece como mucho O(log n). Si la profundidad supera
+   2 log2(num_elem) aplica heapsort al tramo pendiente.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+inline void quicksort_robusto(Tipo T[], Indice num_elem,
+                              Comparador comp = Comparador());
+
+
+/**
+   @brief Ordena parte de un vector por quicksort con profundidad acotada.
+
+   @param T: vector de elementos. Tiene un número de elementos
+                   mayor o igual a final. Es MODIFICADO.
+   @param inicial: Posición que marca el incio de la parte del
+                   vector a ordenar.
+   @param final: Posición detrás de la última de la parte del
+                   vector a ordenar.
+		   inicial < final.
+   @param profundidad: número de particiones permitidas antes de
+                   recurrir a heapsort.
+   @param comp: orden estricto entre elementos.
+*/
+template <class Tipo, class Comparador>
+void quicksort_robusto_lims(Tipo T[], Indice inicial, Indice final, int profundidad,
+                            Comparador comp);
+
+
+/**
+   @brief Sitúa en T[inicial] un pivote representativo del tramo.
+
+   @param T: vector de elementos. Es MODIFICADO.
+   @param inicial: Posición de inicio del tramo.
+   @param final: Posición detrás de la última del tramo.
+		   final - inicial >= 3.
+   @param comp: orden estricto entre elementos.
+
+   Toma la mediana de los elementos inicial, central y final - 1 o,
+   si el tramo tiene más de UMBRAL_NINTHER elementos, la mediana de
+   las medianas de tres ternas repartidas por el tramo (ninther de
+   Tukey), y la intercambia con T[inicial].
+*/
+template <class Tipo, class Comparador>
+inline void elegir_pivote(Tipo T[], Indice inicial, Indice final, Comparador comp);
+
+
+/**
+   @brief Redistribuye los elementos de un vector según el pivote T[inicial].
+
+   @param T: vector de elementos. Tiene un número de elementos
+                   mayor o igual a final. Es MODIFICADO.
+   @param inicial: Posición del pivote e inicio del tramo.
+   @param final: Posición detrás de la última del tramo.
+		   inicial < final.
+   @param pp: Posición final del pivote. Es MODIFICADO.
+   @param comp: orden estricto entre elementos.
+
+   Como dividir_qs, pero ambos recorridos se detienen en los elementos
+   iguales al pivote, de modo que un tramo con muchas repeticiones se
+   divide en dos partes de tamaño parecido. Quedan en [inicial, pp)
+   elementos no mayores que el pivote y en (pp, final) elementos no
+   menores.
+*/
+template <class Tipo, class Comparador>
+inline void dividir_robusto(Tipo T[], Indice inicial, Indice final, Indice & pp,
+                            Comparador comp);
+
+
+
+/**
+   Implementación de las funciones
+**/
+
+
+const int UMBRAL_NINTHER = 128;
+
+
+template <class Tipo, class Comparador>
+inline void quicksort(Tipo T[], Indice num_elem, Comparador comp)
+{
+  quicksort_lims(T, 0, num_elem, comp);
+}
+
+template <class Tipo, class Comparador>
+void quicksort_lims(Tipo T[], Indice inicial, Indice final, Comparador comp)
+{
+  Indice k;
+  if (final - inicial < umbral<Tipo>(HIBRIDO_QUICKSORT)) {
+    insercion_lims(T, inicial, final, comp);
+  } else {
+    dividir_qs(T, inicial, final, k, comp);
+    quicksort_lims(T, inicial, k, comp);
+    quicksort_lims(T, k + 1, final, comp);
+  };
+}
+
+
+template <class Tipo, class Comparador>
+inline void dividir_qs(Tipo T[], Indice inicial, Indice final, Indice & pp,
+                       Comparador comp)
+{
+  Tipo pivote, aux;
+  Indice k, l;
+
+  pivote = T[inicial];
+  k = inicial;
+  l = final;
+  do {
+    k++;
+  } while (!comp(pivote, T[k]) && (k < final-1));
+  do {
+    l--;
+  } while (comp(pivote, T[l]));
+  while (k < l) {
+    aux = T[k];
+    T[k] = T[l];
+    T[l] = aux;
+    do k++; while (!comp(pivote, T[k]));
+    do l--; while (comp(pivote, T[l]));
+  };
+  aux = T[inicial];
+  T[inicial] = T[l];
+  T[l] = aux;
+  pp = l;
+};
+
+
+template <class Tipo, class Comparador>
+inline void quicksort_robusto(Tipo T[], Indice num_elem, Comparador comp)
+{
+  int profundidad = 0;
+  for (Indice n = num_elem; n > 1; n /= 2)
+    profundidad += 2;
+  quicksort_robusto_lims(T, 0, num_elem, profundidad, comp);
+}
+
+
+template <class Tipo, class Comparador>
+void quicksort_robusto_lims(Tipo T[], Indice inicial, Indice final, int profundidad,
+                            Comparador comp)
+{
+  const int u = umbral<Tipo>(HIBRIDO_QUICKSORT_ROBUSTO);
+  Indice k;
+  while (final - inicial >= u) {
+    if (profundidad == 0) {
+      heapsort(T + inicial, final - inicial, comp);
+      return;
+    }
+    profundidad--;
+
+    elegir_pivote(T, inicial, final, comp);
+    dividir_robusto(T, inicial, final, k, comp);
+
+    // Recursión sobre la parte menor, iteración sobre la mayor
+    if (k - inicial < final - (k + 1)) {
+      quicksort_robusto_lims(T, inicial, k, profundidad, comp);
+      inicial = k + 1;
+    } else {
+      quicksort_robusto_lims(T, k + 1, final, profundidad, comp);
+      final = k;
+    }
+  }
+  insercion_lims(T, inicial, final, comp);
+}
+
+
+/**
+   @brief Posición del mediano de T[a], T[b] y T[c] según comp.
+*/
+template <class Tipo, class Comparador>
+inline Indice mediana3(const Tipo T[], Indice a, Indice b, Indice c, Comparador comp)
+{
+  if (comp(T[a], T[b])) {
+    if (comp(T[b], T[c])) return b;
+    return comp(T[a], T[c]) ? c : a;
+  }
+  if (comp(T[a], T[c])) return a;
+  return comp(T[b], T[c]) ? c : b;
+}
+
+
+template <class Tipo, class Comparador>
+inline void elegir_pivote(Tipo T[], Indice inicial, Indice final, Comparador comp)
+{
+  Indice n = final - inicial;
+  Indice medio = inicial + n / 2;
+  Indice ultimo = final - 1;
+  Indice m;
+  if (n > UMBRAL_NINTHER) {
+    Indice s = n / 8;
+    m = mediana3(T,
+                 mediana3(T, inicial, inicial + s, inicial + 2 * s, comp),
+                 mediana3(T, medio - s, medio, medio + s, comp),
+                 mediana3(T, ultimo - 2 * s, ultimo - s, ultimo, comp),
+                 comp);
+  } else {
+    m = mediana3(T, inicial, medio, ultimo, comp);
+  }
+  std::swap(T[inicial], T[m]);
+}
+
+
+template <class Tipo, class Comparador>
+inline void dividir_robusto(Tipo T[], Indice inicial, Indice final, Indice & pp,
+                            Comparador comp)
+{
+  const Tipo pivote = T[inicial];
+  Indice k = inicial;
+  Indice l = final;
+  while (true) {
+    do k++; while (k < final && comp(T[k], pivote));
+    // T[inicial] detiene el recorrido por la izquierda
+    do l--; while (comp(pivote, T[l]));
+    if (k >= l)
+      break;
+    std::swap(T[k], T[l]);
+  }
+  std::swap(T[inicial], T[l]);
+  pp = l;
+}
+
+
+#endif
@@ -0,0 +1,235 @@
+/**
+   @file quicksort_paralelo.h
+   @brief Ordenación rápida paralela con partición por bloques.
+   @date 2026-10-17
+*/
+
+#ifndef QUICKSORT_PARALELO_H
+#define QUICKSORT_PARALELO_H
+
+#include "arena.h"
+#include "quicksort.h"
+#include "planificador.h"
+
+#include <functional>
+#include <algorithm>
+#include <vector>
+
+
+/* ************************************************************ */
+/*  Método de ordenación rápida paralelo  */
+
+/**
+   @brief Ordena un vector por el método quicksort usando varios hilos.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param planificador: hilos en los que se reparte el trabajo.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   Cambia el orden de los elementos de T de forma que los dispone
+   en sentido creciente de menor a mayor según comp.
+   Las dos llamadas recursivas se ejecutan como tareas concurrentes y
+   cada tramo se divide con particion_paralela, que separa los iguales
+   al pivote y los excluye de la recursión. Como en quicksort_robusto,
+   la parte menor se lanza como tarea y se itera sobre la mayor, y si
+   la profundidad supera 2 log2(num_elem) se aplica heapsort al tramo
+   pendiente. Por debajo de CORTE_QS_PARALELO elementos se aplica
+   quicksort_robusto. Usa un vector auxiliar de num_elem elementos.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+void quicksort_paralelo(Tipo T[], Indice num_elem, Planificador & planificador,
+                        Comparador comp = Comparador());
+
+
+/**
+   @brief Redistribuye en paralelo los elementos de un vector según un pivote.
+
+   @param T: vector de elementos. Tiene un número de elementos
+                   mayor o igual a final. Es MODIFICADO.
+   @param aux: vector auxiliar del mismo tamaño que T. Es MODIFICADO.
+   @param inicial: Posición que marca el incio de la parte del
+                   vector a dividir.
+   @param final: Posición detrás de la última de la parte del
+                   vector a dividir.
+		   inicial < final.
+   @param pi: Posición del primer elemento igual al pivote. Es MODIFICADO.
+   @param pd: Posición detrás del último igual al pivote. Es MODIFICADO.
+   @param planificador: hilos en los que se reparte el trabajo.
+   @param comp: orden estricto entre elementos.
+
+   Elige el pivote con elegir_pivote, que lo deja en T[inicial]. Divide
+   el tramo en bloques de al menos BLOQUE_PARTICION elementos; cada
+   tarea cuenta en su bloque los menores, iguales y mayores que el
+   pivote, una suma de prefijos da a cada bloque su posición de
+   escritura en aux para cada clase, cada tarea reparte su bloque en aux
+   y, por último, los bloques se copian de vuelta a T. Quedan los
+   menores en [inicial, pi), los iguales en [pi, pd) y los mayores en
+   [pd, final).
+*/
+template <class Tipo, class Comparador>
+void particion_paralela(Tipo T[], Tipo aux[], Indice inicial, Indice final,
+                        Indice & pi, Indice & pd, Planificador & planificador,
+                        Comparador comp);
+
+
+
+/**
+   Implementación de las funciones
+**/
+
+
+const int CORTE_QS_PARALELO = 1 << 15;
+const int BLOQUE_PARTICION = 1 << 14;
+
+
+template <class Tipo, class Comparador>
+void particion_paralela(Tipo T[], Tipo aux[], Indice inicial, Indice final,
+                        Indice & pi, Indice & pd, Planificador & planificador,
+                        Comparador comp)
+{
+  elegir_pivote(T, inicial, final, comp);
+  const Tipo pivote = T[inicial];
+
+  Indice n = final - inicial;
+  Indice bloques = std::min<Indice>(4 * planificador.hilos(), n / BLOQUE_PARTICION);
+  if (bloques < 1)
+    bloques = 1;
+
+  // Cuenta por bloque: menores, iguales y mayores
+  std::vector<Indice> menores(bloques), iguales(bloques), mayores(bloques);
+  GrupoTareas contar;
+  for (Indice k = 0; k < bloques; k++)
+    planificador.lanzar(contar, [&, k]() {
+      Indice ini = inicial + n * k / bloques;
+      Indice fin = inicial + n * (k + 1) / bloques;
+      Indice m = 0, i = 0;
+      for (Indice j = ini; j < fin; j++) {
+        if (comp(T[j], pivote))
+          m++;
+        else if (!comp(pivote, T[j]))
+          i++;
+      }
+      menores[k] = m;
+      iguales[k] = i;
+      mayores[k] = (fin - ini) - m - i;
+    });
+  planificador.esperar(contar);
+
+  // Suma de prefijos: posición de escritura de cada clase en cada bloque
+  Indice total_menores = 0, total_iguales = 0;
+  for (Indice k = 0; k < bloques; k++) {
+    total_menores += menores[k];
+    total_iguales += iguales[k];
+  }
+  Indice pm = inicial, pig = inicial + total_menores;
+  Indice pma = pig + total_iguales;
+  for (Indice k = 0; k < bloques; k++) {
+    Indice m = menores[k], i = iguales[k], M = mayores[k];
+    menores[k] = pm;
+    iguales[k] = pig;
+    mayores[k] = pma;
+    pm += m;
+    pig += i;
+    pma += M;
+  }
+
+  // Reparto de cada bloque en aux
+  GrupoTareas repartir;
+  for (Indice k = 0; k < bloques; k++)
+    planificador.lanzar(repartir, [&, k]() {
+      Indice ini = inicial + n * k / bloques;
+      Indice fin = inicial + n * (k + 1) / bloques;
+      Indice m = menores[k], i = iguales[k], M = mayores[k];
+      for (Indice j = ini; j < fin; j++) {
+        if (comp(T[j], pivote))
+          aux[m++] = T[j];
+        else if (comp(pivote, T[j]))
+          aux[M++] = T[j];
+        else
+          aux[i++] = T[j];
+      }
+    });
+  planificador.esperar(repartir);
+
+  // Copia de vuelta, también por bloques
+  GrupoTareas copiar;
+  for (Indice k = 0; k < bloques; k++)
+    planificador.lanzar(copiar, [&, k]() {
+      Indice ini = inicial + n * k / bloques;
+      Indice fin = inicial + n * (k + 1) / bloques;
+      std::copy(aux + ini, aux + fin, T + ini);
+    });
+  planificador.esperar(copiar);
+
+  pi = inicial + total_menores;
+  pd = pi + total_iguales;
+}
+
+
+/**
+   @brief Ordena T[inicial, final) lanzando las partes menores como tareas.
+
+   @param profundidad: número de particiones permitidas antes de
+                   recurrir a heapsort.
+*/
+template <class Tipo, class Comparador>
+void quicksort_paralelo_lims(Tipo T[], Tipo aux[], Indice inicial, Indice final,
+                             int profundidad, Planificador & planificador,
+                             Comparador comp)
+{
+  GrupoTareas grupo;
+  Indice pi, pd;
+  while (final - inicial > CORTE_QS_PARALELO) {
+    if (profundidad == 0) {
+      heapsort(T + inicial, final - inicial, comp);
+      planificador.esperar(grupo);
+      return;
+    }
+    profundidad--;
+
+    particion_paralela(T, aux, inicial, final, pi, pd, planificador, comp);
+
+    // Tarea con la parte menor, iteración sobre la mayor
+    if (pi - inicial < final - pd) {
+      if (pi - inicial > 1)
+        planificador.lanzar(grupo, [=, &planificador]() {
+          quicksort_paralelo_lims(T, aux, inicial, pi, profundidad,
+                                  planificador, comp);
+        });
+      inicial = pd;
+    } else {
+      if (final - pd > 1)
+        planificador.lanzar(grupo, [=, &planificador]() {
+          quicksort_paralelo_lims(T, aux, pd, final, profundidad,
+                                  planificador, comp);
+        });
+      final = pi;
+    }
+  }
+  if (final - inicial > 1)
+    quicksort_robusto(T + inicial, final - inicial, comp);
+  planificador.esperar(grupo);
+}
+
+
+template <class Tipo, class Comparador>
+void quicksort_paralelo(Tipo T[], Indice num_elem, Planificador & planificador,
+                        Comparador comp)
+{
+  if (num_elem <= CORTE_QS_PARALELO || planificador.hilos() == 1) {
+    quicksort_robusto(T, num_elem, comp);
+    return;
+  }
+
+  int profundidad = 0;
+  for (Indice n = num_elem; n > 1; n /= 2)
+    profundidad += 2;
+  Tipo * aux = reservar_auxiliar<Tipo>(num_elem);
+  quicksort_paralelo_lims(T, aux, 0, num_elem, profundidad, planificador, comp);
+  liberar_auxiliar(aux);
+}
+
+
+#endif
@@ -0,0 +1,122 @@
+/**
+   @file quicksort_vectorial.h
+   @brief Ordenación rápida con partición vectorial (SIMD) para float.
+   @date 2026-10-17
+*/
+
+#ifndef QUICKSORT_VECTORIAL_H
+#define QUICKSORT_VECTORIAL_H
+
+#include "quicksort.h"
+#include "particion_vectorial.h"
+
+#include <functional>
+#include <algorithm>
+
+
+/* ************************************************************ */
+/*  Método de ordenación rápida vectorial  */
+
+/**
+   @brief Ordena un vector por quicksort con la partición vectorial.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   Cambia el orden de los elementos de T de forma que los dispone
+   en sentido creciente de menor a mayor según comp.
+   Para float con operator< es quicksort_robusto con la división de
+   particion_vectorial, que compara un bloque de elementos con el
+   pivote en cada instrucción en lugar de uno con cada salto. Para el
+   resto de tipos y criterios aplica quicksort_robusto.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+inline void quicksort_vectorial(Tipo T[], Indice num_elem,
+                                Comparador comp = Comparador());
+
+inline void quicksort_vectorial(float T[], Indice num_elem,
+                                std::less<float> comp = std::less<float>());
+
+
+/**
+   @brief Ordena parte de un vector de float por quicksort vectorial.
+
+   @param T: vector de elementos. Tiene un número de elementos
+                   mayor o igual a final. Es MODIFICADO.
+   @param inicial: Posición que marca el incio de la parte del
+                   vector a ordenar.
+   @param final: Posición detrás de la última de la parte del
+                   vector a ordenar.
+		   inicial < final.
+   @param profundidad: número de particiones permitidas antes de
+                   recurrir a heapsort.
+
+   Como quicksort_robusto_lims. Si ningún elemento es menor que el
+   pivote, separa los iguales a él, que ya están en su sitio, en lugar
+   de recurrir sobre ellos.
+*/
+inline void quicksort_vectorial_lims(float T[], Indice inicial, Indice final,
+                                     int profundidad);
+
+
+
+/**
+   Implementación de las funciones
+**/
+
+
+template <class Tipo, class Comparador>
+inline void quicksort_vectorial(Tipo T[], Indice num_elem, Comparador comp)
+{
+  quicksort_robusto(T, num_elem, comp);
+}
+
+
+inline void quicksort_vectorial(float T[], Indice num_elem, std::less<float>)
+{
+  int profundidad = 0;
+  for (Indice n = num_elem; n > 1; n /= 2)
+    profundidad += 2;
+  quicksort_vectorial_lims(T, 0, num_elem, profundidad);
+}
+
+
+inline void quicksort_vectorial_lims(float T[], Indice inicial, Indice final,
+                                     int profundidad)
+{
+  std::less<float> comp;
+  const int u = umbral<float>(HIBRIDO_QUICKSORT_VECTORIAL);
+  Indice k;
+  while (final - inicial >= u) {
+    if (profundidad == 0) {
+      heapsort(T + inicial, final - inicial, comp);
+      return;
+    }
+    profundidad--;
+
+    elegir_pivote(T, inicial, final, comp);
+    float pivote = T[inicial];
+    k = particion_vectorial(T, inicial + 1, final, pivote, false) - 1;
+    if (k == inicial) {
+      // El pivote es el mínimo: los iguales a él ya están ordenados
+      inicial = particion_vectorial(T, inicial + 1, final, pivote, true);
+      continue;
+    }
+    std::swap(T[inicial], T[k]);
+
+    // Recursión sobre la parte menor, iteración sobre la mayor
+    if (k - inicial < final - (k + 1)) {
+      quicksort_vectorial_lims(T, inicial, k, profundidad);
+      inicial = k + 1;
+    } else {
+      quicksort_vectorial_lims(T, k + 1, final, profundidad);
+      final = k;
+    }
+  }
+  insercion_lims(T, inicial, final, comp);
+}
+
+
+#endif
@@ -0,0 +1,184 @@
+/**
+   @file radix.h
+   @brief Ordenación por residuos (radix sort LSD) sobre la representación binaria.
+   @date 2026-10-17
+*/
+
+#ifndef RADIX_H
+#define RADIX_H
+
+#include "arena.h"
+#include "tipos.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+/* ************************************************************ */
+/*  Método de ordenación por residuos  */
+
+/**
+   @brief Ordena un vector por residuos, de la cifra menos a la más significativa.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param aux: vector auxiliar de num_elem elementos o NULL. Si es NULL
+               se reserva uno. Es MODIFICADO.
+
+   Cambia el orden de los elementos de T de forma que los dispone
+   en sentido creciente de menor a mayor según su clave (ver
+   ClaveRadix). No compara elementos: traduce cada clave a un entero
+   sin signo que conserva el orden y reparte los elementos por cifras
+   de ClaveRadix<Tipo>::BITS bits. Los histogramas de todas las cifras
+   se calculan en una sola pasada y se omiten las cifras en las que
+   todas las claves coinciden. Es estable.
+*/
+template <class Tipo>
+void radix(Tipo T[], Indice num_elem, Tipo aux[] = NULL);
+
+
+/**
+   @brief Clave entera sin signo de cada tipo de elemento.
+
+   Clave es el tipo entero, BITS el ancho de cada cifra (de modo que la
+   tabla de una cifra quepa en L1) y clave(x) la traducción, que debe
+   cumplir a < b si y sólo si clave(a) < clave(b).
+*/
+template <class Tipo>
+struct ClaveRadix;
+
+
+/**
+   @brief Traduce los bits de un float IEEE-754 a un entero ordenado.
+
+   A los positivos se les activa el bit de signo y a los negativos se
+   les invierten todos los bits. -0.0 se trata como +0.0, pues ambos
+   son iguales para operator<.
+*/
+inline uint32_t clave_float(float x)
+{
+  uint32_t b;
+  memcpy(&b, &x, sizeof(b));
+  if (b == 0x80000000u)
+    b = 0;
+  return b ^ (-(b >> 31) | 0x80000000u);
+}
+
+
+/**
+   @brief Como clave_float para double.
+*/
+inline uint64_t clave_double(double x)
+{
+  uint64_t b;
+  memcpy(&b, &x, sizeof(b));
+  if (b == 0x8000000000000000ull)
+    b = 0;
+  return b ^ (-(b >> 63) | 0x8000000000000000ull);
+}
+
+
+template <>
+struct ClaveRadix<float> {
+  typedef uint32_t Clave;
+  static const int BITS = 11;
+  static Clave clave(float x) { return clave_float(x); }
+};
+
+template <>
+struct ClaveRadix<double> {
+  typedef uint64_t Clave;
+  static const int BITS = 8;
+  static Clave clave(double x) { return clave_double(x); }
+};
+
+template <>
+struct ClaveRadix<uint32_t> {
+  typedef uint32_t Clave;
+  static const int BITS = 11;
+  static Clave clave(uint32_t x) { return x; }
+};
+
+template <>
+struct ClaveRadix<uint64_t> {
+  typedef uint64_t Clave;
+  static const int BITS = 8;
+  static Clave clave(uint64_t x) { return x; }
+};
+
+template <>
+struct ClaveRadix<Registro> {
+  typedef uint32_t Clave;
+  static const int BITS = 11;
+  static Clave clave(const Registro & x) { return clave_float(x.clave); }
+};
+
+
+
+/**
+   Implementación de las funciones
+**/
+
+
+template <class Tipo>
+void radix(Tipo T[], Indice num_elem, Tipo aux[])
+{
+  typedef ClaveRadix<Tipo> Traduccion;
+  typedef typename Traduccion::Clave Clave;
+  const int BITS = Traduccion::BITS;
+  const int CUBETAS = 1 << BITS;
+  const int CIFRAS = (8 * sizeof(Clave) + BITS - 1) / BITS;
+  const Clave MASCARA = CUBETAS - 1;
+  if (num_elem <= 1)
+    return;
+
+  // Histogramas de todas las cifras en una sola pasada
+  Indice histograma[CIFRAS][CUBETAS];
+  memset(histograma, 0, sizeof(histograma));
+  Indice i, c;
+  for (i = 0; i < num_elem; i++) {
+    Clave k = Traduccion::clave(T[i]);
+    for (c = 0; c < CIFRAS; c++)
+      histograma[c][(k >> (c * BITS)) & MASCARA]++;
+  }
+
+  Tipo * propio = NULL;
+  Tipo * origen = T;
+  Tipo * destino = aux;
+
+  for (c = 0; c < CIFRAS; c++) {
+    Indice * h = histograma[c];
+
+    // Si todas las claves comparten la cifra, la pasada no mueve nada
+    Clave primera = (Traduccion::clave(T[0]) >> (c * BITS)) & MASCARA;
+    if (h[primera] == num_elem)
+      continue;
+
+    if (destino == NULL)
+      destino = propio = reservar_auxiliar<Tipo>(num_elem);
+
+    // Suma de prefijos: posición de escritura de cada cubeta
+    Indice suma = 0;
+    for (int b = 0; b < CUBETAS; b++) {
+      Indice cuenta = h[b];
+      h[b] = suma;
+      suma += cuenta;
+    }
+
+    for (i = 0; i < num_elem; i++) {
+      Clave k = (Traduccion::clave(origen[i]) >> (c * BITS)) & MASCARA;
+      destino[h[k]++] = origen[i];
+    }
+    std::swap(origen, destino);
+  }
+
+  if (origen != T)
+    std::copy(origen, origen + num_elem, T);
+  liberar_auxiliar(propio);
+}
+
+
+#endif
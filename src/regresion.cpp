@@ -0,0 +1,441 @@
+/**
+   @file regresion.cpp
+   @brief Compara un barrido con una referencia y detecta regresiones.
+   @date 2026-10-17
+
+   Lee los .dat de algoritmo de dos directorios (por ejemplo test_arch
+   y la salida de un barrido nuevo), en el formato de dos columnas de
+   las referencias antiguas o en el de benchmark.cpp, y compara cada
+   algoritmo presente en ambos sobre los tamaños comunes:
+
+   - Por tamaño, el cociente entre la mediana nueva y la de referencia,
+     con un intervalo que se obtiene de los intervalos de confianza de
+     las dos medianas. El tamaño empeora si el cociente supera
+     1 + umbral y el intervalo entero está por encima de 1.
+
+   - Por serie, la constante a del modelo a·f(n) de su familia (n² para
+     los cuadráticos, n para radix y n·log n para el resto), estimada
+     como la media geométrica de t / f(n), y el exponente b del ajuste
+     por mínimos cuadrados de log t = c + b·log n.
+
+   Un algoritmo tiene una regresión si su constante crece más que el
+   umbral y empeora en la mayoría de los tamaños, o si su exponente
+   crece más que el umbral de crecimiento. El programa termina con 1 si
+   hay alguna regresión, de modo que puede parar un script de
+   compilación.
+*/
+
+
+#include "tipos.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <getopt.h>
+#include <dirent.h>
+
+using std::cout;
+using std::cerr;
+using std::endl;
+using std::string;
+using std::vector;
+using std::map;
+
+
+/* ************************************************************ */
+/*  Lectura de los .dat  */
+
+/**
+   @brief Medición de un tamaño. Sin intervalo, ic_inf = ic_sup = mediana.
+*/
+struct Medida {
+  double mediana;
+  double ic_inf;
+  double ic_sup;
+};
+
+typedef map<Indice, Medida> Serie;
+
+
+/**
+   Ficheros de los directorios de salida que no son de un algoritmo.
+**/
+static const char * TABLAS[] = {
+  "cuadraticos", "nlogn", "ruido", "calibracion", "escalado", "externo",
+  "datos", "registros", "parcial", "incremental"
+};
+
+
+/**
+   @brief Indica si nombre (sin .dat) es una tabla o uno de sus sufijos
+   (nlogn_double, ruido_registro...).
+*/
+static bool es_tabla(const string & nombre)
+{
+  for (size_t i = 0; i < sizeof(TABLAS) / sizeof(TABLAS[0]); i++) {
+    string t = TABLAS[i];
+    if (nombre == t || nombre.compare(0, t.size() + 1, t + "_") == 0)
+      return true;
+  }
+  return false;
+}
+
+
+/**
+   @brief Lee la serie de un .dat de algoritmo.
+
+   Salta las líneas vacías y los comentarios. Con once columnas o más
+   (formato de benchmark.cpp) toma la mediana y su intervalo de las
+   columnas 2, 8 y 9; con menos, sólo el tiempo de la segunda.
+   @return false si no se puede leer o no tiene ninguna fila.
+*/
+static bool leer_serie(const string & fichero, Serie & s)
+{
+  std::ifstream f(fichero.c_str());
+  if (!f)
+    return false;
+
+  string linea;
+  while (getline(f, linea)) {
+    if (linea.empty() || linea[0] == '#')
+      continue;
+    std::istringstream ss(linea);
+    vector<double> c;
+    double v;
+    while (ss >> v)
+      c.push_back(v);
+    if (c.size() < 2 || c[1] <= 0)
+      continue;
+    Medida m;
+    m.mediana = m.ic_inf = m.ic_sup = c[1];
+    if (c.size() >= 11 && c[7] > 0 && c[8] >= c[7]) {
+      m.ic_inf = c[7];
+      m.ic_sup = c[8];
+    }
+    s[(Indice) c[0]] = m;
+  }
+  return !s.empty();
+}
+
+
+/**
+   @brief Nombres (sin .dat) de los ficheros de algoritmo de un directorio.
+*/
+static std::set<string> listar(const string & directorio)
+{
+  std::set<string> nombres;
+  DIR * d = opendir(directorio.c_str());
+  if (d == NULL)
+    return nombres;
+  struct dirent * e;
+  while ((e = readdir(d)) != NULL) {
+    string n = e->d_name;
+    if (n.size() > 4 && n.compare(n.size() - 4, 4, ".dat") == 0) {
+      n.erase(n.size() - 4);
+      if (!es_tabla(n))
+        nombres.insert(n);
+    }
+  }
+  closedir(d);
+  return nombres;
+}
+
+
+/* ************************************************************ */
+/*  Modelos y ajustes  */
+
+enum Modelo { LINEAL, NLOGN, CUADRATICO };
+
+static const char * NOMBRE_MODELO[] = { "n", "nlogn", "n^2" };
+
+
+/**
+   @brief Modelo de crecimiento esperado del algoritmo de un fichero.
+
+   El nombre puede llevar los sufijos de tipo y distribución de
+   benchmark.cpp (burbuja_double, radix_uint32_zipf...).
+*/
+static Modelo modelo(const string & nombre)
+{
+  static const struct { const char * algoritmo; Modelo m; } MODELOS[] = {
+    { "burbuja", CUADRATICO },
+    { "insercion", CUADRATICO },
+    { "seleccion", CUADRATICO },
+    { "radix", LINEAL },
+  };
+  for (size_t i = 0; i < sizeof(MODELOS) / sizeof(MODELOS[0]); i++) {
+    string a = MODELOS[i].algoritmo;
+    if (nombre == a || nombre.compare(0, a.size() + 1, a + "_") == 0)
+      return MODELOS[i].m;
+  }
+  return NLOGN;
+}
+
+
+static double f(Modelo m, Indice n)
+{
+  switch (m) {
+  case LINEAL:     return (double) n;
+  case CUADRATICO: return (double) n * n;
+  default:         return n * std::log2((double) n);
+  }
+}
+
+
+/**
+   @brief Constante del modelo a·f(n): media geométrica de t / f(n).
+
+   En escala logarítmica es el ajuste por mínimos cuadrados con la
+   pendiente del modelo, así que cada tamaño pesa lo mismo aunque los
+   tiempos de los mayores sean cientos de veces los de los menores.
+   Se saltan los tamaños en los que f(n) no es positivo (n = 1 en
+   n·log n); sin ninguno válido la constante es 1.
+*/
+static double constante(const Serie & s, const vector<Indice> & tamanios,
+                        Modelo m)
+{
+  double suma = 0;
+  int validos = 0;
+  for (size_t i = 0; i < tamanios.size(); i++) {
+    double fn = f(m, tamanios[i]);
+    if (fn <= 0)
+      continue;
+    suma += std::log(s.at(tamanios[i]).mediana / fn);
+    validos++;
+  }
+  return validos > 0 ? std::exp(suma / validos) : 1;
+}
+
+
+/**
+   @brief Pendiente b del ajuste por mínimos cuadrados de
+   log t = c + b·log n.
+*/
+static double exponente(const Serie & s, const vector<Indice> & tamanios)
+{
+  double sx = 0, sy = 0, sxx = 0, sxy = 0;
+  int k = tamanios.size();
+  for (int i = 0; i < k; i++) {
+    double x = std::log((double) tamanios[i]);
+    double y = std::log(s.at(tamanios[i]).mediana);
+    sx += x;
+    sy += y;
+    sxx += x * x;
+    sxy += x * y;
+  }
+  double d = k * sxx - sx * sx;
+  return d > 0 ? (k * sxy - sx * sy) / d : 0;
+}
+
+
+/* ************************************************************ */
+/*  Comparación  */
+
+/**
+   @brief Resultado de comparar un algoritmo con su referencia.
+*/
+struct Comparacion {
+  string nombre;
+  Modelo modelo;
+  int tamanios;           ///< Tamaños comunes.
+  int peores;             ///< Tamaños que empeoran significativamente.
+  double constante;       ///< Cociente de las constantes (nueva / referencia).
+  double exponente_ref;
+  double exponente;
+  bool regresion_constante;
+  bool regresion_crecimiento;
+  vector<string> detalle; ///< Una línea por tamaño que empeora.
+};
+
+
+/**
+   @brief Compara la serie nueva de un algoritmo con la de referencia.
+
+   @param nombre: nombre del algoritmo (del fichero, sin .dat).
+   @param ref: serie de referencia.
+   @param nueva: serie nueva.
+   @param umbral: aumento relativo tolerado de los tiempos y la constante.
+   @param umbral_exponente: aumento tolerado del exponente.
+*/
+static Comparacion comparar(const string & nombre, const Serie & ref,
+                            const Serie & nueva, double umbral,
+                            double umbral_exponente)
+{
+  Comparacion c;
+  c.nombre = nombre;
+  c.modelo = modelo(nombre);
+  c.peores = 0;
+
+  vector<Indice> comunes;
+  for (Serie::const_iterator it = ref.begin(); it != ref.end(); ++it)
+    if (nueva.count(it->first))
+      comunes.push_back(it->first);
+  c.tamanios = comunes.size();
+
+  for (size_t i = 0; i < comunes.size(); i++) {
+    const Medida & r = ref.at(comunes[i]);
+    const Medida & m = nueva.at(comunes[i]);
+    double cociente = m.mediana / r.mediana;
+    // Cociente de los extremos opuestos de los dos intervalos
+    double inferior = m.ic_inf / r.ic_sup;
+    if (cociente > 1 + umbral && inferior > 1) {
+      c.peores++;
+      char linea[128];
+      snprintf(linea, sizeof(linea), "n = %td: %g s -> %g s (x%.3f, >= x%.3f)",
+               comunes[i], r.mediana, m.mediana, cociente, inferior);
+      c.detalle.push_back(linea);
+    }
+  }
+
+  c.constante = c.tamanios > 0 ? constante(nueva, comunes, c.modelo) /
+                                 constante(ref, comunes, c.modelo) : 1;
+  c.exponente_ref = exponente(ref, comunes);
+  c.exponente = exponente(nueva, comunes);
+  c.regresion_constante = c.constante > 1 + umbral && 2 * c.peores > c.tamanios;
+  c.regresion_crecimiento = c.tamanios >= 3 &&
+                            c.exponente - c.exponente_ref > umbral_exponente;
+  return c;
+}
+
+
+static void uso(const char * programa)
+{
+  cerr << "Formato " << programa << " [opciones] <directorio_referencia> "
+       << "<directorio_nuevo>" << endl
+       << "  -a alg1,alg2,...  algoritmos a comparar (por defecto, todos" << endl
+       << "                    los que tienen .dat en los dos directorios)" << endl
+       << "  -u umbral         aumento relativo tolerado de los tiempos y" << endl
+       << "                    de la constante del modelo (0.10)" << endl
+       << "  -e umbral         aumento tolerado del exponente de" << endl
+       << "                    crecimiento (0.10)" << endl
+       << "  -v                muestra los tamaños que empeoran" << endl
+       << "  -h                muestra esta ayuda" << endl
+       << "Termina con 1 si algún algoritmo tiene una regresión." << endl;
+}
+
+
+int main(int argc, char * argv[])
+{
+  double umbral = 0.10;
+  double umbral_exponente = 0.10;
+  bool detalle = false;
+  std::set<string> elegidos;
+
+  int opcion;
+  while ((opcion = getopt(argc, argv, "a:u:e:vh")) != -1) {
+    switch (opcion) {
+    case 'a': {
+      std::stringstream ss(optarg);
+      string nombre;
+      while (getline(ss, nombre, ','))
+        elegidos.insert(nombre);
+      break;
+    }
+    case 'u':
+      umbral = atof(optarg);
+      if (umbral < 0) {
+        cerr << "El umbral no puede ser negativo" << endl;
+        return -1;
+      }
+      break;
+    case 'e':
+      umbral_exponente = atof(optarg);
+      if (umbral_exponente < 0) {
+        cerr << "El umbral de crecimiento no puede ser negativo" << endl;
+        return -1;
+      }
+      break;
+    case 'v':
+      detalle = true;
+      break;
+    case 'h':
+      uso(argv[0]);
+      return 0;
+    default:
+      uso(argv[0]);
+      return -1;
+    }
+  }
+
+  if (optind != argc - 2) {
+    uso(argv[0]);
+    return -1;
+  }
+  string referencia = argv[optind], nuevo = argv[optind + 1];
+
+  std::set<string> en_ref = listar(referencia), en_nuevo = listar(nuevo);
+  if (en_ref.empty() || en_nuevo.empty()) {
+    cerr << "No hay ficheros .dat de algoritmo en "
+         << (en_ref.empty() ? referencia : nuevo) << endl;
+    return -1;
+  }
+  for (std::set<string>::const_iterator it = elegidos.begin();
+       it != elegidos.end(); ++it)
+    if (!en_ref.count(*it) || !en_nuevo.count(*it)) {
+      cerr << "Falta " << *it << ".dat en uno de los directorios" << endl;
+      return -1;
+    }
+
+  char linea[160];
+  snprintf(linea, sizeof(linea), "%-24s %-8s %7s %9s %16s  %s",
+           "algoritmo", "modelo", "peores", "constante", "exponente", "");
+  cout << linea << endl;
+
+  int regresiones = 0, comparados = 0;
+  for (std::set<string>::const_iterator it = en_nuevo.begin();
+       it != en_nuevo.end(); ++it) {
+    if (!en_ref.count(*it) || (!elegidos.empty() && !elegidos.count(*it)))
+      continue;
+
+    Serie ref, nueva;
+    if (!leer_serie(referencia + "/" + *it + ".dat", ref) ||
+        !leer_serie(nuevo + "/" + *it + ".dat", nueva)) {
+      cerr << "No se puede leer " << *it << ".dat" << endl;
+      return -1;
+    }
+
+    Comparacion c = comparar(*it, ref, nueva, umbral, umbral_exponente);
+    if (c.tamanios == 0) {
+      cout << *it << ": sin tamaños comunes" << endl;
+      continue;
+    }
+    comparados++;
+
+    string veredicto;
+    if (c.regresion_constante)
+      veredicto += "REGRESION(constante) ";
+    if (c.regresion_crecimiento)
+      veredicto += "REGRESION(crecimiento)";
+    char peores[16], exponentes[32];
+    snprintf(peores, sizeof(peores), "%d/%d", c.peores, c.tamanios);
+    snprintf(exponentes, sizeof(exponentes), "%.3f -> %.3f",
+             c.exponente_ref, c.exponente);
+    snprintf(linea, sizeof(linea), "%-24s %-8s %7s %8.3fx %16s  %s",
+             c.nombre.c_str(), NOMBRE_MODELO[c.modelo], peores, c.constante,
+             exponentes, veredicto.c_str());
+    cout << linea << endl;
+
+    if (detalle)
+      for (size_t i = 0; i < c.detalle.size(); i++)
+        cout << "\t" << c.detalle[i] << endl;
+    regresiones += c.regresion_constante || c.regresion_crecimiento;
+  }
+
+  if (comparados == 0) {
+    cerr << "Ningún algoritmo tiene tamaños comunes en los dos directorios"
+         << endl;
+    return -1;
+  }
+
+  cout << endl << regresiones << " de " << comparados
+       << " algoritmos con regresión (umbral " << umbral
+       << ", crecimiento " << umbral_exponente << ")" << endl;
+  return regresiones > 0 ? 1 : 0;
+}
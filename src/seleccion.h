@@ -0,0 +1,87 @@
+/**
+   @file seleccion.h
+   @brief Ordenación por selección
+   @date 2023-3-6
+*/
+
+#ifndef SELECCION_H
+#define SELECCION_H
+
+#include "tipos.h"
+
+#include <functional>
+
+
+/* ************************************************************ */
+/*  Método de ordenación por selección  */
+
+/**
+   @brief Ordena un vector por el método de selección.
+
+   @param T: vector de elementos. Debe tener num_elem elementos.
+             Es MODIFICADO.
+   @param num_elem: número de elementos. num_elem > 0.
+   @param comp: orden estricto entre elementos. Por defecto, operator<.
+
+   Cambia el orden de los elementos de T de forma que los dispone
+   en sentido creciente de menor a mayor según comp.
+   Aplica el algoritmo de selección.
+*/
+template <class Tipo, class Comparador = std::less<Tipo> >
+inline void seleccion(Tipo T[], Indice num_elem, Comparador comp = Comparador());
+
+
+
+/**
+   @brief Ordena parte de un vector por el método de selección.
+
+   @param T: vector de elementos. Tiene un número de elementos
+                   mayor o igual a final. Es MODIFICADO.
+   @param inicial: Posición que marca el incio de la parte del
+                   vector a ordenar.
+   @param final: Posición detrás de la última de la parte del
+                   vector a ordenar.
+		   inicial < final.
+   @param comp: orden estricto entre elementos.
+
+   Cambia el orden de los elementos de T entre las posiciones
+   inicial y final - 1de forma que los dispone en sentido creciente
+   de menor a mayor según comp.
+   Aplica el algoritmo de selección.
+*/
+template <class Tipo, class Comparador>
+inline void seleccion_lims(Tipo T[], Indice inicial, Indice final, Comparador comp);
+
+
+
+/**
+   Implementación de las funciones
+**/
+
+template <class Tipo, class Comparador>
+inline void seleccion(Tipo T[], Indice num_elem, Comparador comp)
+{
+  seleccion_lims(T, 0, num_elem, comp);
+}
+
+template <class Tipo, class Comparador>
+inline void seleccion_lims(Tipo T[], Indice inicial, Indice final, Comparador comp)
+{
+  Indice i, j, indice_menor;
+  Tipo menor, aux;
+  for (i = inicial; i < final - 1; i++) {
+    indice_menor = i;
+    menor = T[i];
+    for (j = i; j < final; j++)
+      if (comp(T[j], menor)) {
+	indice_menor = j;
+	menor = T[j];
+      }
+    aux = T[i];
+    T[i] = T[indice_menor];
+    T[indice_menor] = aux;
+  };
+}
+
+
+#endif
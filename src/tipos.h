@@ -0,0 +1,63 @@
+/**
+   @file tipos.h
+   @brief Tipos de elemento con los que se instancian los algoritmos y
+   tipo de los índices.
+   @date 2026-10-17
+*/
+
+#ifndef TIPOS_H
+#define TIPOS_H
+
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+   @brief Tamaños de vector y posiciones en él.
+
+   Con signo, para que las diferencias entre posiciones y los bucles
+   que bajan hasta 0 no den la vuelta, y de 64 bits, para vectores de
+   más de 2^31 elementos.
+*/
+typedef std::ptrdiff_t Indice;
+
+
+/**
+   @brief Registro formado por una clave y una carga asociada.
+
+   Se ordena sólo por la clave; la carga permite comprobar que los
+   algoritmos mueven el registro completo.
+*/
+struct Registro {
+  float clave;
+  uint32_t carga;
+};
+
+inline bool operator<(const Registro & a, const Registro & b)
+{
+  return a.clave < b.clave;
+}
+
+
+/**
+   @brief Registro de Bytes bytes: una clave float y una carga que lo
+   completa.
+
+   Sirve para medir cómo crece con el tamaño del registro el coste de
+   moverlo. Bytes debe ser múltiplo de 4 y mayor que 4.
+*/
+template <int Bytes>
+struct RegistroCarga {
+  float clave;
+  uint32_t carga[(Bytes - sizeof(float)) / sizeof(uint32_t)];
+};
+
+template <int Bytes>
+inline bool operator<(const RegistroCarga<Bytes> & a,
+                      const RegistroCarga<Bytes> & b)
+{
+  return a.clave < b.clave;
+}
+
+
+#endif
@@ -0,0 +1,98 @@
+/**
+   @file umbrales.cpp
+   @brief Umbrales de inserción de los algoritmos híbridos, por tipo de elemento.
+   @date 2026-10-17
+*/
+
+
+#include "umbrales.h"
+#include "tipos.h"
+
+#include <fstream>
+#include <sstream>
+#include <cstdint>
+
+
+static const char * NOMBRES[NUM_HIBRIDOS] = {
+  "quicksort", "quicksort_robusto", "quicksort_vectorial",
+  "mergesort", "mergesort_descendente", "mergesort_ascendente",
+  "mergesort_kvias", "mergesort_natural"
+};
+
+
+/**
+   @brief Umbrales de cada tipo de elemento, con el nombre de -t.
+*/
+struct UmbralesTipo {
+  const char * nombre;
+  int * valor;
+};
+
+static const UmbralesTipo TIPOS[] = {
+  { "float",    Umbrales<float>::valor },
+  { "double",   Umbrales<double>::valor },
+  { "uint32",   Umbrales<uint32_t>::valor },
+  { "uint64",   Umbrales<uint64_t>::valor },
+  { "registro", Umbrales<Registro>::valor },
+};
+
+static const int NUM_TIPOS = sizeof(TIPOS) / sizeof(TIPOS[0]);
+
+
+const char * nombre_hibrido(Hibrido h)
+{
+  return NOMBRES[h];
+}
+
+
+bool cargar_umbrales(const char * fichero, std::string & error)
+{
+  std::ifstream f(fichero);
+  if (!f) {
+    error = std::string("no se puede abrir ") + fichero;
+    return false;
+  }
+
+  std::string linea;
+  int num_linea = 0;
+  while (getline(f, linea)) {
+    num_linea++;
+    std::istringstream ss(linea);
+    std::string algoritmo, tipo;
+    int valor;
+    if (!(ss >> algoritmo) || algoritmo[0] == '#')
+      continue;
+
+    int h = 0, t = 0;
+    if (ss >> tipo >> valor) {
+      while (h < NUM_HIBRIDOS && algoritmo != NOMBRES[h])
+        h++;
+      while (t < NUM_TIPOS && tipo != TIPOS[t].nombre)
+        t++;
+    }
+    if (!ss || h == NUM_HIBRIDOS || t == NUM_TIPOS ||
+        valor < UMBRAL_MINIMO) {
+      std::ostringstream e;
+      e << fichero << ":" << num_linea << ": línea no válida";
+      error = e.str();
+      return false;
+    }
+    TIPOS[t].valor[h] = valor;
+  }
+  return true;
+}
+
+
+bool guardar_umbrales(const char * fichero)
+{
+  std::ofstream f(fichero);
+  if (!f)
+    return false;
+
+  f << "# algoritmo tipo umbral" << std::endl;
+  for (int h = 0; h < NUM_HIBRIDOS; h++)
+    for (int t = 0; t < NUM_TIPOS; t++)
+      f << NOMBRES[h] << " " << TIPOS[t].nombre << " "
+        << TIPOS[t].valor[h] << std::endl;
+  return bool(f);
+}
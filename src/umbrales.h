@@ -0,0 +1,100 @@
+/**
+   @file umbrales.h
+   @brief Umbrales de inserción de los algoritmos híbridos, por tipo de elemento.
+   @date 2026-10-17
+*/
+
+#ifndef UMBRALES_H
+#define UMBRALES_H
+
+#include <string>
+
+
+/**
+   @brief Algoritmos que ordenan por inserción los tramos pequeños.
+
+   Cada uno tiene su propio umbral para cada tipo de elemento: los
+   tramos con menos elementos que el umbral se ordenan por inserción.
+*/
+enum Hibrido {
+  HIBRIDO_QUICKSORT,
+  HIBRIDO_QUICKSORT_ROBUSTO,
+  HIBRIDO_QUICKSORT_VECTORIAL,
+  HIBRIDO_MERGESORT,
+  HIBRIDO_MERGESORT_DESCENDENTE,
+  HIBRIDO_MERGESORT_ASCENDENTE,
+  HIBRIDO_MERGESORT_KVIAS,
+  HIBRIDO_MERGESORT_NATURAL,
+  NUM_HIBRIDOS
+};
+
+
+const int UMBRAL_QS = 50;
+const int UMBRAL_MS = 100;
+const int UMBRAL_NATURAL = 32;    ///< Tramo natural mínimo.
+
+/**
+   Menor umbral que admiten todos los híbridos: las divisiones de
+   mergesort necesitan tramos de al menos dos elementos y elegir_pivote
+   y dividir_qs, de al menos tres.
+**/
+const int UMBRAL_MINIMO = 3;
+
+
+/**
+   @brief Umbrales de los algoritmos híbridos para el tipo Tipo.
+
+   Empiezan con UMBRAL_QS para las variantes de quicksort, UMBRAL_MS
+   para las de mergesort y UMBRAL_NATURAL para mergesort_natural, que
+   completa por inserción los tramos más cortos, y pueden cambiarse con
+   cargar_umbrales o con la calibración del banco de pruebas.
+*/
+template <class Tipo>
+struct Umbrales {
+  static int valor[NUM_HIBRIDOS];
+};
+
+template <class Tipo>
+int Umbrales<Tipo>::valor[NUM_HIBRIDOS] = {
+  UMBRAL_QS, UMBRAL_QS, UMBRAL_QS, UMBRAL_MS, UMBRAL_MS, UMBRAL_MS, UMBRAL_MS,
+  UMBRAL_NATURAL
+};
+
+
+template <class Tipo>
+inline int umbral(Hibrido h)
+{
+  return Umbrales<Tipo>::valor[h];
+}
+
+
+/**
+   @brief Nombre del algoritmo híbrido h, el mismo del banco de pruebas.
+*/
+const char * nombre_hibrido(Hibrido h);
+
+
+/**
+   @brief Lee los umbrales de un fichero.
+
+   @param fichero: ruta del fichero.
+   @param error: descripción del error, si lo hay. Es MODIFICADO.
+   @return false si no se puede abrir o alguna línea no es válida; las
+           líneas anteriores a la errónea ya se han aplicado.
+
+   Cada línea tiene el nombre del algoritmo, el del tipo de elemento y
+   el umbral, separados por espacios, y el umbral no puede ser menor que
+   UMBRAL_MINIMO. Las que empiezan por # se ignoran.
+*/
+bool cargar_umbrales(const char * fichero, std::string & error);
+
+
+/**
+   @brief Escribe los umbrales de todos los algoritmos y tipos con el
+   formato de cargar_umbrales.
+   @return false si no se puede escribir el fichero.
+*/
+bool guardar_umbrales(const char * fichero);
+
+
+#endif